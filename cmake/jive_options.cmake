@@ -1,6 +1,8 @@
 include_guard()
 
+option(JIVE_BUILD_BENCHMARKS "Build JIVE's benchmarking runner?" OFF)
 option(JIVE_BUILD_TEST_RUNNER "Build JIVE's test runner?" OFF)
 option(JIVE_BUILD_DEMO_RUNNER "Build JIVE's demo runner?" OFF)
 option(JIVE_ENABLE_COVERAGE "Generate coverage reports when running tests?" OFF)
 option(JIVE_ENABLE_SANITISERS "Enable ASan, LSan, UBSan?" OFF)
+option(JIVE_ENABLE_INSTRUMENTATION "Enable per-phase instrumentation in JIVE's benchmarking runner?" OFF)
@@ -2,85 +2,91 @@
 
 namespace jive
 {
-    BoxModel::BoxModel(juce::ValueTree stateSource)
-        : state{ stateSource }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , minWidth{ state, "min-width" }
-        , minHeight{ state, "min-height" }
-        , maxWidth{ state, "max-width" }
-        , maxHeight{ state, "max-height" }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
-        , componentSize{ state, "component-size" }
-        , padding{ state, "padding" }
-        , border{ state, "border-width" }
-        , margin{ state, "margin" }
-        , isValid{ state, "box-model-valid" }
-        , callbackLock{ state, "box-model-callback-lock" }
-    {
-        if (!width.exists())
-            width.setAuto();
-        if (!height.exists())
-            height.setAuto();
-        if (!isValid.exists())
-            isValid = true;
-        if (!componentSize.exists())
+    class BoxModel::LayoutState
+    {
+    public:
+        explicit LayoutState(const juce::ValueTree& treeToLayOut)
+            : tree{ treeToLayOut }
         {
-            componentSize = juce::Rectangle{
-                calculateComponentWidth(),
-                calculateComponentHeight(),
-            };
         }
 
-        const auto onBoxModelChanged = [this]() {
-            if (callbackLock.get())
+        void invalidate()
+        {
+            if (numCallbackLocks > 0)
                 return;
 
-            isValid = true;
-            listeners.call(&Listener::boxModelChanged, *this);
-            invalidateParent();
-        };
-        const auto recalculateSize = [this, onBoxModelChanged]() {
-            if (callbackLock.get())
-                return;
+            boxModels.call([](BoxModel& boxModel) {
+                boxModel.listeners.call(&Listener::boxModelInvalidated, boxModel);
+            });
+        }
+
+        template <typename ValueType>
+        void mirror([[maybe_unused]] const juce::Identifier& id,
+                    [[maybe_unused]] const ValueType& value)
+        {
+#if JIVE_MIRROR_LAYOUT_STATE
+            tree.setProperty(id, juce::VariantConverter<ValueType>::toVar(value), nullptr);
+#endif
+        }
+
+        juce::ValueTree tree;
+        std::optional<juce::Rectangle<float>> componentSize;
+        std::optional<float> idealWidth;
+        std::optional<float> idealHeight;
+        juce::uint32 intrinsicSizeVersion = 0;
+        int numCallbackLocks = 0;
+        juce::ListenerList<BoxModel> boxModels;
+    };
 
-            const auto sizeBefore = componentSize.get();
-            componentSize = juce::Rectangle{
+    BoxModel::BoxModel(juce::ValueTree stateSource)
+        : state{ stateSource }
+        , width{ state, ids::width() }
+        , height{ state, ids::height() }
+        , minWidth{ state, ids::minWidth() }
+        , minHeight{ state, ids::minHeight() }
+        , maxWidth{ state, ids::maxWidth() }
+        , maxHeight{ state, ids::maxHeight() }
+        , padding{ state, ids::padding() }
+        , border{ state, ids::borderWidth() }
+        , margin{ state, ids::margin() }
+        , layoutState{ PropertyDispatcher::getOrCreate(state)->getOrCreateAttachment<LayoutState>() }
+    {
+        width.setDefault("auto");
+        height.setDefault("auto");
+
+        if (!layoutState->componentSize.has_value())
+        {
+            layoutState->componentSize = juce::Rectangle{
                 calculateComponentWidth(),
                 calculateComponentHeight(),
             };
+            layoutState->mirror(ids::componentSize(), *layoutState->componentSize);
+        }
 
-            if (componentSize.get() == sizeBefore)
-                onBoxModelChanged();
+        const auto onSizePropertyChanged = [this]() {
+            recalculateSize();
         };
+        width.onValueChange = onSizePropertyChanged;
+        height.onValueChange = onSizePropertyChanged;
+        padding.onValueChange = onSizePropertyChanged;
+        border.onValueChange = onSizePropertyChanged;
+        margin.onValueChange = onSizePropertyChanged;
+        minWidth.onValueChange = onSizePropertyChanged;
+        minHeight.onValueChange = onSizePropertyChanged;
+        maxWidth.onValueChange = onSizePropertyChanged;
+        maxHeight.onValueChange = onSizePropertyChanged;
+
+        layoutState->boxModels.add(this);
+    }
 
-        width.onValueChange = recalculateSize;
-        height.onValueChange = recalculateSize;
-        padding.onValueChange = recalculateSize;
-        border.onValueChange = recalculateSize;
-        margin.onValueChange = recalculateSize;
-        minWidth.onValueChange = recalculateSize;
-        minHeight.onValueChange = recalculateSize;
-        maxWidth.onValueChange = recalculateSize;
-        maxHeight.onValueChange = recalculateSize;
-
-        idealWidth.onValueChange = onBoxModelChanged;
-        idealHeight.onValueChange = onBoxModelChanged;
-        componentSize.onValueChange = onBoxModelChanged;
-
-        isValid.onValueChange = [this]() {
-            if (callbackLock.get())
-                return;
-
-            if (!isValid.get())
-                listeners.call(&Listener::boxModelInvalidated, *this);
-        };
+    BoxModel::~BoxModel()
+    {
+        layoutState->boxModels.remove(this);
     }
 
     float BoxModel::getWidth() const
     {
-        return componentSize.get().getWidth();
+        return getOuterBounds().getWidth();
     }
 
     bool BoxModel::hasAutoWidth() const
@@ -90,7 +96,7 @@ namespace jive
 
     float BoxModel::getHeight() const
     {
-        return componentSize.get().getHeight();
+        return getOuterBounds().getHeight();
     }
 
     bool BoxModel::hasAutoHeight() const
@@ -100,7 +106,7 @@ namespace jive
 
     void BoxModel::setSize(float newWidth, float newHeight)
     {
-        componentSize = juce::Rectangle{ newWidth, newHeight };
+        setComponentSize({ newWidth, newHeight });
 
         if (!state.getParent().isValid())
         {
@@ -126,7 +132,7 @@ namespace jive
 
     juce::Rectangle<float> BoxModel::getOuterBounds() const
     {
-        return componentSize.get();
+        return layoutState->componentSize.value_or(juce::Rectangle<float>{});
     }
 
     juce::Rectangle<float> BoxModel::getContentBounds() const
@@ -156,6 +162,53 @@ namespace jive
         };
     }
 
+    std::optional<float> BoxModel::getIdealWidth() const
+    {
+        return layoutState->idealWidth;
+    }
+
+    std::optional<float> BoxModel::getIdealHeight() const
+    {
+        return layoutState->idealHeight;
+    }
+
+    void BoxModel::setIdealWidth(float newIdealWidth)
+    {
+        if (layoutState->idealWidth == newIdealWidth)
+            return;
+
+        layoutState->idealWidth = newIdealWidth;
+        layoutState->mirror(ids::idealWidth(), newIdealWidth);
+        layoutState->intrinsicSizeVersion++;
+        layoutState->boxModels.call(&BoxModel::onBoxModelChanged);
+    }
+
+    void BoxModel::setIdealHeight(float newIdealHeight)
+    {
+        if (layoutState->idealHeight == newIdealHeight)
+            return;
+
+        layoutState->idealHeight = newIdealHeight;
+        layoutState->mirror(ids::idealHeight(), newIdealHeight);
+        layoutState->intrinsicSizeVersion++;
+        layoutState->boxModels.call(&BoxModel::onBoxModelChanged);
+    }
+
+    void BoxModel::invalidate()
+    {
+        layoutState->invalidate();
+    }
+
+    juce::uint32 BoxModel::getIntrinsicSizeVersion() const
+    {
+        return layoutState->intrinsicSizeVersion;
+    }
+
+    void BoxModel::intrinsicSizeChanged()
+    {
+        layoutState->intrinsicSizeVersion++;
+    }
+
     void BoxModel::addListener(Listener& listener) const
     {
         const_cast<juce::ListenerList<Listener>*>(&listeners)->add(&listener);
@@ -168,13 +221,23 @@ namespace jive
 
     juce::Rectangle<float> BoxModel::getParentBounds() const
     {
-        if (state.getParent().isValid())
+        const auto parent = state.getParent();
+
+        if (!parent.isValid())
+            return juce::Rectangle<float>{};
+
+        if (const auto parentDispatcher = PropertyDispatcher::find(parent))
         {
-            const Property<juce::Rectangle<float>> parentSize{ state.getParent(), componentSize.id };
-            return parentSize.get();
+            if (const auto parentState = parentDispatcher->findAttachment<LayoutState>();
+                parentState != nullptr && parentState->componentSize.has_value())
+            {
+                return *parentState->componentSize;
+            }
         }
 
-        return juce::Rectangle<float>{};
+        // Parents without a box model of their own can still specify their
+        // size in the tree.
+        return juce::VariantConverter<juce::Rectangle<float>>::fromVar(parent[ids::componentSize()]);
     }
 
     float BoxModel::calculateComponentWidth() const
@@ -193,14 +256,52 @@ namespace jive
         return height.toPixels(getParentBounds());
     }
 
+    void BoxModel::setComponentSize(juce::Rectangle<float> newSize)
+    {
+        if (layoutState->componentSize == newSize)
+            return;
+
+        layoutState->componentSize = newSize;
+        layoutState->mirror(ids::componentSize(), newSize);
+        layoutState->boxModels.call(&BoxModel::onBoxModelChanged);
+    }
+
+    void BoxModel::recalculateSize()
+    {
+        layoutState->intrinsicSizeVersion++;
+
+        if (isLocked())
+            return;
+
+        const auto sizeBefore = getOuterBounds();
+        setComponentSize({
+            calculateComponentWidth(),
+            calculateComponentHeight(),
+        });
+
+        if (getOuterBounds() == sizeBefore)
+            onBoxModelChanged();
+    }
+
+    void BoxModel::onBoxModelChanged()
+    {
+        if (isLocked())
+            return;
+
+        listeners.call(&Listener::boxModelChanged, *this);
+        invalidateParent();
+    }
+
     void BoxModel::invalidateParent()
     {
-        if (auto parent = state.getParent();
+        if (const auto parent = state.getParent();
             parent.isValid())
         {
-            Property<bool> parentIsValid{ parent, isValid.id };
-            parentIsValid = true;
-            parentIsValid = false;
+            if (const auto parentDispatcher = PropertyDispatcher::find(parent))
+            {
+                if (const auto parentState = parentDispatcher->findAttachment<LayoutState>())
+                    parentState->invalidate();
+            }
         }
     }
 
@@ -217,12 +318,18 @@ namespace jive
 
     void BoxModel::lock()
     {
-        callbackLock = true;
+        layoutState->numCallbackLocks++;
     }
 
     void BoxModel::unlock()
     {
-        callbackLock.clear();
+        jassert(layoutState->numCallbackLocks > 0);
+        layoutState->numCallbackLocks--;
+    }
+
+    bool BoxModel::isLocked() const
+    {
+        return layoutState->numCallbackLocks > 0;
     }
 } // namespace jive
 
@@ -242,6 +349,8 @@ public:
         testBorder();
         testMargin();
         testContentBounds();
+        testLayoutState();
+        testInvalidatingParent();
     }
 
 private:
@@ -298,6 +407,22 @@ private:
             state.setProperty("height", "50%", nullptr);
             expectEquals(boxModel.getHeight(), 444.0f);
         }
+
+        // Child of a component without a box model
+        {
+            juce::ValueTree parentState{
+                "Component",
+                {
+                    { "component-size", "0 0 200 100" },
+                },
+                {
+                    juce::ValueTree{ "Component", { { "width", "50%" }, { "height", "25%" } } },
+                },
+            };
+            jive::BoxModel boxModel{ parentState.getChild(0) };
+            expectEquals(boxModel.getWidth(), 100.0f);
+            expectEquals(boxModel.getHeight(), 25.0f);
+        }
     }
 
     void testPadding()
@@ -373,6 +498,94 @@ private:
                          150.0f - 30.0f - 30.0f - 5.0f - 15.0f,
                      });
     }
+
+    void testLayoutState()
+    {
+        beginTest("layout state");
+
+        juce::ValueTree state{ "Component", { { "width", 100 } } };
+        jive::BoxModel box{ state };
+        jive::BoxModel otherBox{ state };
+        auto numInvalidations = 0;
+
+        struct Listener : jive::BoxModel::Listener
+        {
+            explicit Listener(int& counter)
+                : numInvalidations{ counter }
+            {
+            }
+
+            void boxModelInvalidated(jive::BoxModel&) final
+            {
+                numInvalidations++;
+            }
+
+            int& numInvalidations;
+        } listener{ numInvalidations };
+        otherBox.addListener(listener);
+
+        box.setSize(30.0f, 40.0f);
+        box.setIdealWidth(25.0f);
+        box.invalidate();
+        expectEquals(otherBox.getOuterBounds(), juce::Rectangle{ 30.0f, 40.0f });
+        expectEquals(*otherBox.getIdealWidth(), 25.0f);
+        expect(!otherBox.getIdealHeight().has_value());
+        expectEquals(numInvalidations, 1);
+
+#if !JIVE_MIRROR_LAYOUT_STATE
+        expect(!state.hasProperty("component-size"));
+        expect(!state.hasProperty("ideal-width"));
+#endif
+
+        otherBox.removeListener(listener);
+    }
+
+    void testInvalidatingParent()
+    {
+        beginTest("invalidating parent");
+
+        juce::ValueTree parentState{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 100 },
+            },
+            {
+                juce::ValueTree{ "Component" },
+            },
+        };
+        jive::BoxModel parent{ parentState };
+        jive::BoxModel child{ parentState.getChild(0) };
+        auto numInvalidations = 0;
+
+        struct Listener : jive::BoxModel::Listener
+        {
+            explicit Listener(int& counter)
+                : numInvalidations{ counter }
+            {
+            }
+
+            void boxModelInvalidated(jive::BoxModel&) final
+            {
+                numInvalidations++;
+            }
+
+            int& numInvalidations;
+        } listener{ numInvalidations };
+        parent.addListener(listener);
+
+        child.setIdealWidth(50.0f);
+        expectEquals(numInvalidations, 1);
+
+        // Unchanged ideal sizes don't invalidate anything.
+        child.setIdealWidth(50.0f);
+        expectEquals(numInvalidations, 1);
+
+        child.setIdealHeight(20.0f);
+        expectEquals(numInvalidations, 2);
+
+        parent.removeListener(listener);
+    }
 };
 
 static BoxModelUnitTest boxModelUnitTest;
@@ -33,6 +33,7 @@ namespace jive
         };
 
         explicit BoxModel(juce::ValueTree sourceState);
+        ~BoxModel();
 
         float getWidth() const;
         bool hasAutoWidth() const;
@@ -60,18 +61,49 @@ namespace jive
         juce::Rectangle<float> getMinimumBounds() const;
         juce::Rectangle<float> getMaximumBounds() const;
 
+        /** Returns the size this item's content would ideally be, if it has
+            any content that can be measured.
+        */
+        [[nodiscard]] std::optional<float> getIdealWidth() const;
+        [[nodiscard]] std::optional<float> getIdealHeight() const;
+        void setIdealWidth(float newIdealWidth);
+        void setIdealHeight(float newIdealHeight);
+
+        /** Tells anything laying out this item's children that they need
+            measuring again.
+        */
+        void invalidate();
+
+        /** Returns a number that changes whenever anything that affects how
+            this item is measured by its parent changes, so that the parent
+            can tell whether a previous measurement is still valid.
+        */
+        [[nodiscard]] juce::uint32 getIntrinsicSizeVersion() const;
+
+        /** Call this when this item's content changes in a way that affects
+            its size but isn't reflected in any of the box model's own
+            properties, e.g. when its text changes.
+        */
+        void intrinsicSizeChanged();
+
         void addListener(Listener& listener) const;
         void removeListener(Listener& listener) const;
 
         juce::ValueTree state;
 
     private:
+        class LayoutState;
+
         void lock();
         void unlock();
+        [[nodiscard]] bool isLocked() const;
 
         juce::Rectangle<float> getParentBounds() const;
         float calculateComponentWidth() const;
         float calculateComponentHeight() const;
+        void setComponentSize(juce::Rectangle<float> newSize);
+        void recalculateSize();
+        void onBoxModelChanged();
         void invalidateParent();
 
         Length width;
@@ -80,14 +112,14 @@ namespace jive
         Length minHeight;
         Length maxWidth;
         Length maxHeight;
-        Property<float> idealWidth;
-        Property<float> idealHeight;
-        Property<juce::Rectangle<float>> componentSize;
         Property<juce::BorderSize<float>> padding;
         Property<juce::BorderSize<float>> border;
         Property<juce::BorderSize<float>> margin;
-        Property<bool> isValid;
-        Property<bool> callbackLock;
+
+        // The size and ideal size are computed while laying out, so are kept
+        // out of the tree where changing them would notify its listeners.
+        // They're shared by every BoxModel of the same tree.
+        const std::shared_ptr<LayoutState> layoutState;
 
         juce::ListenerList<Listener> listeners;
 
@@ -2,87 +2,243 @@
 
 namespace jive
 {
-    [[nodiscard]] float Length::toPixels(const juce::Rectangle<float>& parentBounds) const
+    // Finds the font size em or rem lengths are relative to, and remembers it
+    // until the style of any of the trees it was looked for in changes, or
+    // one of those trees moves.
+    class Length::FontSize
+        : private PropertyDispatcher::Subscriber
+        , private Object::Listener
     {
-        if (isAuto())
-            return pixelValueWhenAuto;
+    public:
+        FontSize(const juce::ValueTree& sourceTree, Unit fontSizeUnit)
+            : unit{ fontSizeUnit }
+            , tree{ sourceTree }
+        {
+            jassert(unit == Unit::em || unit == Unit::rem);
+        }
+
+        ~FontSize() override
+        {
+            stopWatching();
+        }
+
+        [[nodiscard]] float get()
+        {
+            if (!size.has_value())
+                size = find();
+
+            return *size;
+        }
+
+        const Unit unit;
+
+    private:
+        [[nodiscard]] float find()
+        {
+            stopWatching();
+
+            // The tree itself is always watched, as it's told when it or any
+            // of its ancestors move.
+            watch(tree);
+
+            if (unit == Unit::rem)
+            {
+                const auto root = tree.getRoot();
+
+                if (root != tree)
+                    watch(root);
+
+                return findIn(root).value_or(0.0f);
+            }
+
+            for (auto toSearch = tree;
+                 toSearch.isValid();
+                 toSearch = toSearch.getParent())
+            {
+                if (toSearch != tree)
+                    watch(toSearch);
+
+                if (const auto fontSize = findIn(toSearch))
+                    return *fontSize;
+            }
+
+            return 0.0f;
+        }
+
+        [[nodiscard]] static std::optional<float> findIn(const juce::ValueTree& treeToSearch)
+        {
+            if (const auto style = treeToSearch[ids::style()];
+                style.isObject())
+            {
+                if (const auto fontSize = style[ids::fontSize()];
+                    fontSize != juce::var{})
+                {
+                    return fromVar<float>(fontSize);
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        void watch(const juce::ValueTree& treeToWatch)
+        {
+            auto dispatcher = PropertyDispatcher::getOrCreate(treeToWatch);
+            dispatcher->subscribe(ids::style(), *this, PropertyDispatcher::Scope::tree);
+            dispatchers.push_back(std::move(dispatcher));
+
+            if (auto* style = dynamic_cast<Object*>(treeToWatch[ids::style()].getDynamicObject()))
+            {
+                style->addListener(*this);
+                styles.emplace_back(style);
+            }
+        }
+
+        void stopWatching()
+        {
+            for (auto& dispatcher : dispatchers)
+                dispatcher->unsubscribe(ids::style(), *this, PropertyDispatcher::Scope::tree);
+
+            for (auto& style : styles)
+                style->removeListener(*this);
+
+            dispatchers.clear();
+            styles.clear();
+        }
+
+        void propertyChanged(juce::ValueTree&, const juce::Identifier&) final
+        {
+            size.reset();
+        }
+
+        void structureChanged() final
+        {
+            size.reset();
+        }
+
+        void propertyChanged(Object&, const juce::Identifier&) final
+        {
+            size.reset();
+        }
+
+        const juce::ValueTree tree;
+        std::optional<float> size;
+        std::vector<std::shared_ptr<PropertyDispatcher>> dispatchers;
+        std::vector<Object::ReferenceCountedPointer> styles;
+    };
+
+    [[nodiscard]] static Orientation getOrientationOf(const juce::Identifier& id)
+    {
+        if (id.toString().containsIgnoreCase("width") || id.toString().containsIgnoreCase("x"))
+            return Orientation::horizontal;
+
+        return Orientation::vertical;
+    }
+
+    Length::Length(juce::ValueTree sourceTree, const juce::Identifier& propertyID)
+        : Property<juce::String>{ sourceTree, propertyID }
+        , orientation{ getOrientationOf(propertyID) }
+    {
+    }
+
+    Length::~Length() = default;
 
-        if (isPixels())
-            return get().getFloatValue();
+    [[nodiscard]] float Length::toPixels(const juce::Rectangle<float>& parentBounds) const
+    {
+        const auto [amount, unit] = getParsedValue();
 
-        if (isPercent())
+        switch (unit)
         {
-            const auto scale = static_cast<double>(get().getFloatValue()) * 0.01;
-            return static_cast<float>(scale * getRelativeParentLength(parentBounds.toDouble()));
+        case Unit::automatic:
+            return pixelValueWhenAuto;
+        case Unit::pixels:
+            return amount;
+        case Unit::percent:
+            return static_cast<float>(static_cast<double>(amount) * 0.01 * getRelativeParentLength(parentBounds.toDouble()));
+        case Unit::em:
+        case Unit::rem:
+            return getFontSize(unit) * amount;
         }
 
-        const auto fontSize = isRem() ? getRootFontSize() : getFontSize();
-        return fontSize * get().getFloatValue();
+        jassertfalse;
+        return pixelValueWhenAuto;
     }
 
     [[nodiscard]] bool Length::isPixels() const
     {
-        return !isAuto() && !isPercent() && !isEm() && !isRem();
+        return getParsedValue().unit == Unit::pixels;
     }
 
     [[nodiscard]] bool Length::isPercent() const
     {
-        return !isAuto() && toString().endsWith("%");
+        return getParsedValue().unit == Unit::percent;
     }
 
     [[nodiscard]] bool Length::isEm() const
     {
-        return !isAuto() && !isRem() && toString().endsWithIgnoreCase("em");
+        return getParsedValue().unit == Unit::em;
     }
 
     [[nodiscard]] bool Length::isRem() const
     {
-        return !isAuto() && toString().endsWithIgnoreCase("rem");
+        return getParsedValue().unit == Unit::rem;
     }
 
-    [[nodiscard]] double Length::getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const
+    void Length::propertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                 const juce::Identifier& property)
     {
-        jassert(tree.getParent().isValid());
+        value.reset();
+        Property<juce::String>::propertyChanged(treeWhosePropertyChanged, property);
+    }
 
-        if (id.toString().containsIgnoreCase("width") || id.toString().containsIgnoreCase("x"))
-            return parentBounds.getWidth();
+    Length::Value Length::getParsedValue() const
+    {
+        if (value.has_value())
+            return *value;
 
-        return parentBounds.getHeight();
+        const auto parsed = exists() ? parse(get()) : Value{ pixelValueWhenAuto, Unit::automatic };
+
+        // The result of a function could change at any time.
+        if (!isFunctional())
+            value = parsed;
+
+        return parsed;
     }
 
-    [[nodiscard]] float Length::getFontSize() const
+    Length::Value Length::parse(const juce::String& text)
     {
-        for (auto toSearch = tree;
-             toSearch.isValid();
-             toSearch = toSearch.getParent())
-        {
-            if (const auto style = toSearch["style"];
-                style.isObject())
-            {
-                if (const auto fontSize = style["font-size"];
-                    fontSize != juce::var{})
-                {
-                    return fromVar<float>(fontSize);
-                }
-            }
-        }
+        const auto trimmed = text.trim();
+
+        if (trimmed.equalsIgnoreCase("auto"))
+            return { pixelValueWhenAuto, Unit::automatic };
 
-        return 0.0f;
+        const auto amount = trimmed.getFloatValue();
+
+        if (trimmed.endsWith("%"))
+            return { amount, Unit::percent };
+        if (trimmed.endsWithIgnoreCase("rem"))
+            return { amount, Unit::rem };
+        if (trimmed.endsWithIgnoreCase("em"))
+            return { amount, Unit::em };
+
+        return { amount, Unit::pixels };
     }
 
-    [[nodiscard]] float Length::getRootFontSize() const
+    [[nodiscard]] double Length::getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const
     {
-        if (const auto style = tree.getRoot()["style"];
-            style.isObject())
-        {
-            if (const auto fontSize = style["font-size"];
-                fontSize != juce::var{})
-            {
-                return fromVar<float>(fontSize);
-            }
-        }
+        jassert(tree.getParent().isValid());
 
-        return 0.0f;
+        if (orientation == Orientation::horizontal)
+            return parentBounds.getWidth();
+
+        return parentBounds.getHeight();
+    }
+
+    [[nodiscard]] float Length::getFontSize(Unit unit) const
+    {
+        if (fontSize == nullptr || fontSize->unit != unit)
+            fontSize = std::make_unique<FontSize>(tree, unit);
+
+        return fontSize->get();
     }
 } // namespace jive
 
@@ -101,6 +257,7 @@ public:
         testPercent();
         testEm();
         testRem();
+        testFontSizeChanges();
     }
 
 private:
@@ -221,6 +378,54 @@ private:
         expect(width.isRem());
         expectEquals(width.toPixels({}), 40.0f);
     }
+
+    void testFontSizeChanges()
+    {
+        beginTest("font-size changes");
+
+        juce::ValueTree state{
+            "Component",
+            {
+                {
+                    "style",
+                    new jive::Object{
+                        { "font-size", 10 },
+                    },
+                },
+            },
+            {
+                juce::ValueTree{ "Component", { { "width", "2em" } } },
+            },
+        };
+        jive::Length width{ state.getChild(0), "width" };
+        expectEquals(width.toPixels({}), 20.0f);
+
+        state.setProperty("style", new jive::Object{ { "font-size", 12 } }, nullptr);
+        expectEquals(width.toPixels({}), 24.0f);
+
+        dynamic_cast<jive::Object*>(state["style"].getDynamicObject())->setProperty("font-size", 15);
+        expectEquals(width.toPixels({}), 30.0f);
+
+        state.getChild(0).setProperty("style", new jive::Object{ { "font-size", 4 } }, nullptr);
+        expectEquals(width.toPixels({}), 8.0f);
+
+        juce::ValueTree otherParent{
+            "Component",
+            {
+                {
+                    "style",
+                    new jive::Object{
+                        { "font-size", 7 },
+                    },
+                },
+            },
+        };
+        state.getChild(0).removeProperty("style", nullptr);
+        auto child = state.getChild(0);
+        state.removeChild(child, nullptr);
+        otherParent.appendChild(child, nullptr);
+        expectEquals(width.toPixels({}), 14.0f);
+    }
 };
 
 static LengthUnitTest lengthUnitTest;
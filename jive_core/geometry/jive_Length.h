@@ -5,7 +5,9 @@ namespace jive
     class Length : public Property<juce::String>
     {
     public:
-        using Property<juce::String>::Property;
+        Length(juce::ValueTree sourceTree, const juce::Identifier& propertyID);
+        ~Length() override;
+
         using Property<juce::String>::operator=;
 
         [[nodiscard]] float toPixels(const juce::Rectangle<float>& parentBounds) const;
@@ -17,9 +19,40 @@ namespace jive
 
         static constexpr auto pixelValueWhenAuto = 0.0f;
 
+    protected:
+        void propertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                             const juce::Identifier& property) override;
+
     private:
+        enum class Unit
+        {
+            automatic,
+            pixels,
+            percent,
+            em,
+            rem,
+        };
+
+        struct Value
+        {
+            float amount;
+            Unit unit;
+        };
+
+        class FontSize;
+
+        [[nodiscard]] Value getParsedValue() const;
+        [[nodiscard]] static Value parse(const juce::String& text);
+
         [[nodiscard]] double getRelativeParentLength(const juce::Rectangle<double>& parentBounds) const;
-        [[nodiscard]] float getFontSize() const;
-        [[nodiscard]] float getRootFontSize() const;
+        [[nodiscard]] float getFontSize(Unit unit) const;
+
+        // Which of the parent's dimensions percentages are relative to.
+        const Orientation orientation;
+
+        // The value is parsed the first time it's needed after it changes,
+        // rather than every time it's used.
+        mutable std::optional<Value> value;
+        mutable std::unique_ptr<FontSize> fontSize;
     };
 } // namespace jive
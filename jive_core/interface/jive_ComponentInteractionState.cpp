@@ -4,8 +4,8 @@ namespace jive
 {
     ComponentInteractionState::ComponentInteractionState(const juce::Component& comp, juce::ValueTree tree)
         : component{ comp }
-        , mouse{ tree, "mouse" }
-        , keyboard{ tree, "keyboard" }
+        , mouse{ tree, ids::mouse() }
+        , keyboard{ tree, ids::keyboard() }
     {
         const_cast<juce::Component&>(component).addMouseListener(this, true);
         juce::Desktop::getInstance().addFocusChangeListener(this);
@@ -4,12 +4,18 @@
 #include "logging/jive_ScopeIndentedLogger.cpp"
 #include "logging/jive_StringStreams.cpp"
 
+#include "profiling/jive_Instrumentation.cpp"
+#include "profiling/jive_MutationRecorder.cpp"
+
 #include "algorithms/jive_Find.cpp"
 
 #include "values/jive_Colours.cpp"
 #include "values/jive_Event.cpp"
 #include "values/jive_Object.cpp"
 #include "values/jive_Property.cpp"
+#include "values/jive_PropertyDispatcher.cpp"
+#include "values/jive_PropertyTransaction.cpp"
+#include "values/jive_PropertyUpdateQueue.cpp"
 #include "values/jive_XmlParser.cpp"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.cpp"
 #include "values/variant-converters/jive_FlexVariantConverters.cpp"
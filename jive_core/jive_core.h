@@ -12,16 +12,42 @@ END_JUCE_MODULE_DECLARATION */
 
 #include <juce_gui_basics/juce_gui_basics.h>
 
+/** Config: JIVE_ENABLE_INSTRUMENTATION
+    Enables the timers and counters placed around each phase of interpreting
+    and laying out a view. When disabled, the instrumentation compiles away to
+    nothing.
+*/
+#ifndef JIVE_ENABLE_INSTRUMENTATION
+    #define JIVE_ENABLE_INSTRUMENTATION 0
+#endif
+
+/** Config: JIVE_MIRROR_LAYOUT_STATE
+    Writes the size and ideal size computed for each item while laying out to
+    its ValueTree (as component-size, ideal-width and ideal-height), for
+    inspecting in a debugger or tree viewer. Nothing reads these properties
+    back, and changing them has no effect.
+*/
+#ifndef JIVE_MIRROR_LAYOUT_STATE
+    #define JIVE_MIRROR_LAYOUT_STATE 0
+#endif
+
 #include "logging/jive_ConsoleProgressBar.h"
 #include "logging/jive_ScopeIndentedLogger.h"
 #include "logging/jive_StringStreams.h"
 
+#include "profiling/jive_Instrumentation.h"
+#include "profiling/jive_MutationRecorder.h"
+
 #include "algorithms/jive_Find.h"
 
 #include "values/jive_Colours.h"
 #include "values/jive_Event.h"
+#include "values/jive_Identifiers.h"
 #include "values/jive_Object.h"
+#include "values/jive_PropertyDispatcher.h"
+#include "values/jive_PropertyTransaction.h"
 #include "values/jive_Property.h"
+#include "values/jive_PropertyUpdateQueue.h"
 #include "values/jive_XmlParser.h"
 #include "values/variant-converters/jive_AttributedStringVariantConverters.h"
 #include "values/variant-converters/jive_FlexVariantConverters.h"
@@ -30,8 +56,8 @@ END_JUCE_MODULE_DECLARATION */
 #include "values/variant-converters/jive_VariantConvertion.h"
 
 #include "geometry/jive_BorderRadii.h"
-#include "geometry/jive_Length.h"
 #include "geometry/jive_Orientation.h"
+#include "geometry/jive_Length.h"
 
 #include "geometry/jive_BoxModel.h"
 
@@ -0,0 +1,209 @@
+#include "jive_Instrumentation.h"
+
+namespace jive
+{
+    static thread_local Instrumentation* activeInstrumentation = nullptr;
+
+    Instrumentation::ScopedActivation::ScopedActivation(Instrumentation& instrumentationToActivate)
+        : previouslyActive{ activeInstrumentation }
+    {
+        activeInstrumentation = &instrumentationToActivate;
+    }
+
+    Instrumentation::ScopedActivation::~ScopedActivation()
+    {
+        activeInstrumentation = previouslyActive;
+    }
+
+    Instrumentation::ScopedTimer::ScopedTimer(Phase phaseToTime)
+        : instrumentation{ activeInstrumentation }
+        , phase{ phaseToTime }
+        , startTicks{ instrumentation != nullptr ? juce::Time::getHighResolutionTicks() : 0 }
+    {
+        if (instrumentation != nullptr)
+        {
+            auto& phaseTotals = instrumentation->getTotals(phase);
+            phaseTotals.numCalls++;
+            phaseTotals.depth++;
+        }
+    }
+
+    Instrumentation::ScopedTimer::~ScopedTimer()
+    {
+        if (instrumentation == nullptr)
+            return;
+
+        auto& phaseTotals = instrumentation->getTotals(phase);
+        phaseTotals.depth--;
+
+        if (phaseTotals.depth == 0)
+            phaseTotals.ticks += juce::Time::getHighResolutionTicks() - startTicks;
+    }
+
+    void Instrumentation::reset()
+    {
+        for (auto& phaseTotals : totals)
+        {
+            phaseTotals.ticks = 0;
+            phaseTotals.numCalls = 0;
+        }
+    }
+
+    double Instrumentation::getTotalMilliseconds(Phase phase) const
+    {
+        return juce::Time::highResolutionTicksToSeconds(getTotals(phase).ticks) * 1000.0;
+    }
+
+    int Instrumentation::getNumCalls(Phase phase) const
+    {
+        return getTotals(phase).numCalls;
+    }
+
+    juce::String Instrumentation::getName(Phase phase)
+    {
+        switch (phase)
+        {
+        case Phase::parsing:
+            return "parse";
+        case Phase::aliasExpansion:
+            return "expand-alias";
+        case Phase::componentCreation:
+            return "create-component";
+        case Phase::decoration:
+            return "decorate";
+        case Phase::childItems:
+            return "set-child-items";
+        case Phase::layout:
+            return "lay-out-children";
+        case Phase::layoutPass:
+            return "perform-layout";
+        case Phase::idealSizeCalculation:
+            return "calculate-ideal-size";
+        case Phase::styling:
+            return "apply-styles";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    Instrumentation* Instrumentation::getActive()
+    {
+        return activeInstrumentation;
+    }
+
+    Instrumentation::PhaseTotals& Instrumentation::getTotals(Phase phase)
+    {
+        return totals[static_cast<std::size_t>(phase)];
+    }
+
+    const Instrumentation::PhaseTotals& Instrumentation::getTotals(Phase phase) const
+    {
+        return totals[static_cast<std::size_t>(phase)];
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class InstrumentationUnitTest : public juce::UnitTest
+{
+public:
+    InstrumentationUnitTest()
+        : juce::UnitTest{ "jive::Instrumentation", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testInactiveTimers();
+        testCounting();
+        testNestedPhases();
+        testReset();
+    }
+
+private:
+    void testInactiveTimers()
+    {
+        beginTest("inactive timers");
+
+        jive::Instrumentation instrumentation;
+        expect(jive::Instrumentation::getActive() == nullptr);
+
+        {
+            const jive::Instrumentation::ScopedTimer timer{ jive::Instrumentation::Phase::layout };
+        }
+
+        expectEquals(instrumentation.getNumCalls(jive::Instrumentation::Phase::layout), 0);
+        expectEquals(instrumentation.getTotalMilliseconds(jive::Instrumentation::Phase::layout), 0.0);
+    }
+
+    void testCounting()
+    {
+        beginTest("counting");
+
+        jive::Instrumentation instrumentation;
+
+        {
+            const jive::Instrumentation::ScopedActivation activation{ instrumentation };
+            expect(jive::Instrumentation::getActive() == &instrumentation);
+
+            for (auto i = 0; i < 3; i++)
+            {
+                const jive::Instrumentation::ScopedTimer timer{ jive::Instrumentation::Phase::decoration };
+            }
+        }
+
+        expect(jive::Instrumentation::getActive() == nullptr);
+        expectEquals(instrumentation.getNumCalls(jive::Instrumentation::Phase::decoration), 3);
+        expectEquals(instrumentation.getNumCalls(jive::Instrumentation::Phase::styling), 0);
+    }
+
+    void testNestedPhases()
+    {
+        beginTest("nested phases");
+
+        jive::Instrumentation outer;
+        jive::Instrumentation inner;
+
+        {
+            const jive::Instrumentation::ScopedActivation outerActivation{ outer };
+            const jive::Instrumentation::ScopedTimer timer{ jive::Instrumentation::Phase::layout };
+
+            {
+                const jive::Instrumentation::ScopedTimer nestedTimer{ jive::Instrumentation::Phase::layout };
+                juce::Thread::sleep(2);
+            }
+
+            {
+                const jive::Instrumentation::ScopedActivation innerActivation{ inner };
+                const jive::Instrumentation::ScopedTimer innerTimer{ jive::Instrumentation::Phase::layout };
+            }
+
+            expect(jive::Instrumentation::getActive() == &outer);
+        }
+
+        expectEquals(outer.getNumCalls(jive::Instrumentation::Phase::layout), 2);
+        expectEquals(inner.getNumCalls(jive::Instrumentation::Phase::layout), 1);
+        expectGreaterOrEqual(outer.getTotalMilliseconds(jive::Instrumentation::Phase::layout), 2.0);
+    }
+
+    void testReset()
+    {
+        beginTest("reset");
+
+        jive::Instrumentation instrumentation;
+
+        {
+            const jive::Instrumentation::ScopedActivation activation{ instrumentation };
+            const jive::Instrumentation::ScopedTimer timer{ jive::Instrumentation::Phase::parsing };
+        }
+
+        expectEquals(instrumentation.getNumCalls(jive::Instrumentation::Phase::parsing), 1);
+
+        instrumentation.reset();
+        expectEquals(instrumentation.getNumCalls(jive::Instrumentation::Phase::parsing), 0);
+        expectEquals(instrumentation.getTotalMilliseconds(jive::Instrumentation::Phase::parsing), 0.0);
+    }
+};
+
+static InstrumentationUnitTest instrumentationUnitTest;
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+namespace jive
+{
+    /** Accumulates the time spent in, and the number of calls made to, each of
+        the phases involved in interpreting and laying out a view.
+
+        Timers only record into the instrumentation that's currently active on
+        the calling thread - see ScopedActivation. Nested calls to the same
+        phase (e.g. a container laying out a nested container) are counted but
+        only the outer-most call is timed, so totals are never counted twice.
+        A phase's total does however include the time spent in any other
+        phases nested within it.
+
+        The JIVE_INSTRUMENT_PHASE() macro used throughout JIVE expands to
+        nothing unless JIVE_ENABLE_INSTRUMENTATION is enabled.
+    */
+    class Instrumentation
+    {
+    public:
+        enum class Phase
+        {
+            parsing,
+            aliasExpansion,
+            componentCreation,
+            decoration,
+            childItems,
+            layout,
+            layoutPass,
+            idealSizeCalculation,
+            styling,
+        };
+
+        static constexpr auto numPhases = static_cast<int>(Phase::styling) + 1;
+
+        class ScopedActivation
+        {
+        public:
+            explicit ScopedActivation(Instrumentation& instrumentationToActivate);
+            ~ScopedActivation();
+
+        private:
+            Instrumentation* const previouslyActive;
+
+            JUCE_DECLARE_NON_COPYABLE(ScopedActivation)
+        };
+
+        class ScopedTimer
+        {
+        public:
+            explicit ScopedTimer(Phase phaseToTime);
+            ~ScopedTimer();
+
+        private:
+            Instrumentation* const instrumentation;
+            const Phase phase;
+            const juce::int64 startTicks;
+
+            JUCE_DECLARE_NON_COPYABLE(ScopedTimer)
+        };
+
+        Instrumentation() = default;
+
+        void reset();
+
+        [[nodiscard]] double getTotalMilliseconds(Phase phase) const;
+        [[nodiscard]] int getNumCalls(Phase phase) const;
+
+        [[nodiscard]] static juce::String getName(Phase phase);
+        [[nodiscard]] static Instrumentation* getActive();
+
+    private:
+        struct PhaseTotals
+        {
+            juce::int64 ticks = 0;
+            int numCalls = 0;
+            int depth = 0;
+        };
+
+        PhaseTotals& getTotals(Phase phase);
+        const PhaseTotals& getTotals(Phase phase) const;
+
+        std::array<PhaseTotals, numPhases> totals;
+
+        JUCE_LEAK_DETECTOR(Instrumentation)
+    };
+} // namespace jive
+
+#if JIVE_ENABLE_INSTRUMENTATION
+    #define JIVE_INSTRUMENT_PHASE(phase) \
+        const ::jive::Instrumentation::ScopedTimer JUCE_JOIN_MACRO(jiveInstrumentedPhase, __LINE__) { ::jive::Instrumentation::Phase::phase }
+    #define JIVE_ACTIVATE_INSTRUMENTATION(instrumentation) \
+        const ::jive::Instrumentation::ScopedActivation JUCE_JOIN_MACRO(jiveActiveInstrumentation, __LINE__) { instrumentation }
+#else
+    #define JIVE_INSTRUMENT_PHASE(phase)
+    #define JIVE_ACTIVATE_INSTRUMENTATION(instrumentation)
+#endif
@@ -0,0 +1,745 @@
+#include "jive_MutationRecorder.h"
+
+namespace jive
+{
+    namespace recordingFormat
+    {
+        static constexpr auto magicNumber = 0x524d564a; // "JVMR"
+        static constexpr auto version = 2;
+
+        enum class ValueEncoding
+        {
+            native,
+            json,
+        };
+    } // namespace recordingFormat
+
+    [[nodiscard]] static bool isSerialisable(const juce::var& value)
+    {
+        if (value.isMethod())
+            return false;
+
+        if (const auto* array = value.getArray())
+            return std::all_of(std::begin(*array), std::end(*array), isSerialisable);
+
+        if (const auto* object = value.getDynamicObject())
+        {
+            const auto& properties = object->getProperties();
+            return std::all_of(std::begin(properties),
+                               std::end(properties),
+                               [](const auto& property) {
+                                   return isSerialisable(property.value);
+                               });
+        }
+
+        return true;
+    }
+
+    // juce::var can't write objects to a stream, so objects and arrays (which
+    // may contain objects) are written as JSON instead.
+    static void writeValue(juce::OutputStream& stream, const juce::var& value)
+    {
+        if (value.isObject() || value.isArray())
+        {
+            stream.writeByte(static_cast<char>(recordingFormat::ValueEncoding::json));
+            stream.writeString(juce::JSON::toString(value, true));
+            return;
+        }
+
+        stream.writeByte(static_cast<char>(recordingFormat::ValueEncoding::native));
+        value.writeToStream(stream);
+    }
+
+    [[nodiscard]] static juce::var readValue(juce::InputStream& stream)
+    {
+        if (static_cast<recordingFormat::ValueEncoding>(stream.readByte()) == recordingFormat::ValueEncoding::json)
+            return parseJSON(stream.readString());
+
+        return juce::var::readFromStream(stream);
+    }
+
+    static void writeTree(juce::OutputStream& stream, const juce::ValueTree& tree)
+    {
+        stream.writeString(tree.getType().toString());
+        stream.writeCompressedInt(tree.getNumProperties());
+
+        for (auto i = 0; i < tree.getNumProperties(); i++)
+        {
+            const auto name = tree.getPropertyName(i);
+            stream.writeString(name.toString());
+            writeValue(stream, tree[name]);
+        }
+
+        stream.writeCompressedInt(tree.getNumChildren());
+
+        for (const auto& child : tree)
+            writeTree(stream, child);
+    }
+
+    // Identifiers can't be empty, so an empty name means the stream is
+    // malformed.
+    [[nodiscard]] static bool readPropertyName(juce::InputStream& stream, juce::Identifier& name)
+    {
+        const auto string = stream.readString();
+
+        if (string.isEmpty())
+            return false;
+
+        name = string;
+        return true;
+    }
+
+    // Returns an invalid tree if the stream doesn't hold a well-formed tree.
+    [[nodiscard]] static juce::ValueTree readTree(juce::InputStream& stream)
+    {
+        const auto type = stream.readString();
+
+        if (type.isEmpty())
+            return juce::ValueTree{};
+
+        juce::ValueTree tree{ type };
+        const auto numProperties = stream.readCompressedInt();
+
+        if (numProperties < 0)
+            return juce::ValueTree{};
+
+        for (auto i = 0; i < numProperties; i++)
+        {
+            if (stream.isExhausted())
+                return juce::ValueTree{};
+
+            juce::Identifier name;
+
+            if (!readPropertyName(stream, name))
+                return juce::ValueTree{};
+
+            tree.setProperty(name, readValue(stream), nullptr);
+        }
+
+        const auto numChildren = stream.readCompressedInt();
+
+        if (numChildren < 0)
+            return juce::ValueTree{};
+
+        for (auto i = 0; i < numChildren; i++)
+        {
+            auto child = readTree(stream);
+
+            if (!child.isValid())
+                return juce::ValueTree{};
+
+            tree.appendChild(child, nullptr);
+        }
+
+        return tree;
+    }
+
+    MutationRecording::MutationRecording(const juce::ValueTree& initialTreeState)
+        : initialState{ initialTreeState }
+    {
+    }
+
+    const juce::ValueTree& MutationRecording::getInitialState() const
+    {
+        return initialState;
+    }
+
+    const std::vector<MutationRecording::Event>& MutationRecording::getEvents() const
+    {
+        return events;
+    }
+
+    juce::RelativeTime MutationRecording::getDuration() const
+    {
+        if (events.empty())
+            return {};
+
+        return events.back().time;
+    }
+
+    void MutationRecording::addEvent(Event event)
+    {
+        events.push_back(std::move(event));
+    }
+
+    void MutationRecording::apply(const Event& event, juce::ValueTree root)
+    {
+        auto tree = root;
+
+        for (const auto index : event.path)
+            tree = tree.getChild(index);
+
+        if (!tree.isValid())
+        {
+            // The tree being replayed into doesn't match the recorded tree!
+            jassertfalse;
+            return;
+        }
+
+        switch (event.type)
+        {
+        case Event::Type::propertyChanged:
+            tree.setProperty(event.property, event.value, nullptr);
+            break;
+        case Event::Type::propertyRemoved:
+            tree.removeProperty(event.property, nullptr);
+            break;
+        case Event::Type::childAdded:
+            tree.addChild(event.child.createCopy(), event.index, nullptr);
+            break;
+        case Event::Type::childRemoved:
+            tree.removeChild(event.index, nullptr);
+            break;
+        case Event::Type::childMoved:
+            tree.moveChild(event.index, event.newIndex, nullptr);
+            break;
+        }
+    }
+
+    void MutationRecording::writeToStream(juce::OutputStream& stream) const
+    {
+        stream.writeInt(recordingFormat::magicNumber);
+        stream.writeCompressedInt(recordingFormat::version);
+        writeTree(stream, initialState);
+        stream.writeCompressedInt(static_cast<int>(events.size()));
+
+        juce::RelativeTime previousTime;
+
+        for (const auto& event : events)
+        {
+            // Times are written as deltas, in microseconds. An int would
+            // overflow after about 35 minutes, which an idle session can
+            // easily go without a mutation.
+            stream.writeByte(static_cast<char>(event.type));
+            stream.writeInt64(static_cast<juce::int64>(std::llround((event.time - previousTime).inSeconds() * 1.0e6)));
+            previousTime = event.time;
+
+            stream.writeCompressedInt(event.path.size());
+
+            for (const auto index : event.path)
+                stream.writeCompressedInt(index);
+
+            switch (event.type)
+            {
+            case Event::Type::propertyChanged:
+                stream.writeString(event.property.toString());
+                writeValue(stream, event.value);
+                break;
+            case Event::Type::propertyRemoved:
+                stream.writeString(event.property.toString());
+                break;
+            case Event::Type::childAdded:
+                stream.writeCompressedInt(event.index);
+                writeTree(stream, event.child);
+                break;
+            case Event::Type::childRemoved:
+                stream.writeCompressedInt(event.index);
+                break;
+            case Event::Type::childMoved:
+                stream.writeCompressedInt(event.index);
+                stream.writeCompressedInt(event.newIndex);
+                break;
+            }
+        }
+    }
+
+    bool MutationRecording::writeToFile(const juce::File& file) const
+    {
+        juce::FileOutputStream stream{ file };
+
+        if (!stream.openedOk())
+            return false;
+
+        stream.setPosition(0);
+        stream.truncate();
+        writeToStream(stream);
+
+        return stream.getStatus().wasOk();
+    }
+
+    std::optional<MutationRecording> MutationRecording::readFromStream(juce::InputStream& stream)
+    {
+        if (stream.readInt() != recordingFormat::magicNumber)
+            return std::nullopt;
+        if (stream.readCompressedInt() != recordingFormat::version)
+            return std::nullopt;
+
+        MutationRecording recording{ readTree(stream) };
+
+        if (!recording.initialState.isValid())
+            return std::nullopt;
+
+        const auto numEvents = stream.readCompressedInt();
+
+        if (numEvents < 0)
+            return std::nullopt;
+
+        juce::RelativeTime time;
+
+        for (auto i = 0; i < numEvents; i++)
+        {
+            if (stream.isExhausted())
+                return std::nullopt;
+
+            const auto type = static_cast<int>(stream.readByte());
+
+            if (type < static_cast<int>(Event::Type::propertyChanged)
+                || type > static_cast<int>(Event::Type::childMoved))
+            {
+                return std::nullopt;
+            }
+
+            Event event;
+            event.type = static_cast<Event::Type>(type);
+            time += juce::RelativeTime{ static_cast<double>(stream.readInt64()) / 1.0e6 };
+            event.time = time;
+
+            const auto pathLength = stream.readCompressedInt();
+
+            if (pathLength < 0)
+                return std::nullopt;
+
+            for (auto j = 0; j < pathLength; j++)
+            {
+                if (stream.isExhausted())
+                    return std::nullopt;
+
+                const auto index = stream.readCompressedInt();
+
+                if (index < 0)
+                    return std::nullopt;
+
+                event.path.add(index);
+            }
+
+            switch (event.type)
+            {
+            case Event::Type::propertyChanged:
+                if (!readPropertyName(stream, event.property))
+                    return std::nullopt;
+
+                event.value = readValue(stream);
+                break;
+            case Event::Type::propertyRemoved:
+                if (!readPropertyName(stream, event.property))
+                    return std::nullopt;
+
+                break;
+            case Event::Type::childAdded:
+                event.index = stream.readCompressedInt();
+                event.child = readTree(stream);
+
+                if (event.index < 0 || !event.child.isValid())
+                    return std::nullopt;
+
+                break;
+            case Event::Type::childRemoved:
+                event.index = stream.readCompressedInt();
+
+                if (event.index < 0)
+                    return std::nullopt;
+
+                break;
+            case Event::Type::childMoved:
+                event.index = stream.readCompressedInt();
+                event.newIndex = stream.readCompressedInt();
+
+                if (event.index < 0 || event.newIndex < 0)
+                    return std::nullopt;
+
+                break;
+            }
+
+            recording.addEvent(std::move(event));
+        }
+
+        return recording;
+    }
+
+    std::optional<MutationRecording> MutationRecording::readFromFile(const juce::File& file)
+    {
+        juce::FileInputStream stream{ file };
+
+        if (!stream.openedOk())
+            return std::nullopt;
+
+        return readFromStream(stream);
+    }
+
+    MutationRecorder::MutationRecorder(juce::ValueTree treeToRecord)
+        : root{ treeToRecord }
+        , startTicks{ juce::Time::getHighResolutionTicks() }
+        , ignoredProperties{
+            ids::componentSize(),
+            ids::idealWidth(),
+            ids::idealHeight(),
+        }
+        , recording{ createSnapshot(root) }
+    {
+        root.addListener(this);
+    }
+
+    MutationRecorder::~MutationRecorder()
+    {
+        root.removeListener(this);
+    }
+
+    void MutationRecorder::setIgnoredProperties(const juce::Array<juce::Identifier>& propertiesToIgnore)
+    {
+        ignoredProperties = propertiesToIgnore;
+    }
+
+    const MutationRecording& MutationRecorder::getRecording() const
+    {
+        return recording;
+    }
+
+    void MutationRecorder::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id)
+    {
+        if (ignoredProperties.contains(id))
+            return;
+
+        if (!tree.hasProperty(id))
+        {
+            auto event = createEvent(MutationRecording::Event::Type::propertyRemoved, tree);
+            event.property = id;
+            recording.addEvent(std::move(event));
+            return;
+        }
+
+        if (!isSerialisable(tree[id]))
+            return;
+
+        auto event = createEvent(MutationRecording::Event::Type::propertyChanged, tree);
+        event.property = id;
+        event.value = tree[id];
+        recording.addEvent(std::move(event));
+    }
+
+    void MutationRecorder::valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& child)
+    {
+        auto event = createEvent(MutationRecording::Event::Type::childAdded, parent);
+        event.index = parent.indexOf(child);
+        event.child = createSnapshot(child);
+        recording.addEvent(std::move(event));
+    }
+
+    void MutationRecorder::valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree&, int index)
+    {
+        auto event = createEvent(MutationRecording::Event::Type::childRemoved, parent);
+        event.index = index;
+        recording.addEvent(std::move(event));
+    }
+
+    void MutationRecorder::valueTreeChildOrderChanged(juce::ValueTree& parent, int oldIndex, int newIndex)
+    {
+        auto event = createEvent(MutationRecording::Event::Type::childMoved, parent);
+        event.index = oldIndex;
+        event.newIndex = newIndex;
+        recording.addEvent(std::move(event));
+    }
+
+    MutationRecording::Event MutationRecorder::createEvent(MutationRecording::Event::Type type,
+                                                           const juce::ValueTree& tree) const
+    {
+        MutationRecording::Event event;
+        event.type = type;
+        event.time = juce::RelativeTime{
+            juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks),
+        };
+
+        for (auto node = tree; node != root && node.getParent().isValid(); node = node.getParent())
+            event.path.insert(0, node.getParent().indexOf(node));
+
+        return event;
+    }
+
+    juce::ValueTree MutationRecorder::createSnapshot(const juce::ValueTree& tree) const
+    {
+        juce::ValueTree snapshot{ tree.getType() };
+
+        for (auto i = 0; i < tree.getNumProperties(); i++)
+        {
+            const auto name = tree.getPropertyName(i);
+
+            if (!ignoredProperties.contains(name) && isSerialisable(tree[name]))
+                snapshot.setProperty(name, tree[name], nullptr);
+        }
+
+        for (const auto& child : tree)
+            snapshot.appendChild(createSnapshot(child), nullptr);
+
+        return snapshot;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class MutationRecorderUnitTest : public juce::UnitTest
+{
+public:
+    MutationRecorderUnitTest()
+        : juce::UnitTest{ "jive::MutationRecorder", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testRecording();
+        testIgnoredProperties();
+        testSerialisation();
+        testLongGaps();
+        testMalformedRecordings();
+        testReplaying();
+    }
+
+private:
+    void testRecording()
+    {
+        beginTest("recording");
+
+        juce::ValueTree tree{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Button" },
+                juce::ValueTree{ "Text" },
+            },
+        };
+        const jive::MutationRecorder recorder{ tree };
+        expectEquals(static_cast<int>(recorder.getRecording().getEvents().size()), 0);
+        expect(recorder.getRecording().getInitialState().isEquivalentTo(tree));
+
+        tree.getChild(1).setProperty("text", "foo", nullptr);
+        tree.getChild(1).removeProperty("text", nullptr);
+        tree.appendChild(juce::ValueTree{ "Image" }, nullptr);
+        tree.moveChild(2, 0, nullptr);
+        tree.removeChild(1, nullptr);
+
+        const auto& events = recorder.getRecording().getEvents();
+        expectEquals(static_cast<int>(events.size()), 5);
+
+        using Type = jive::MutationRecording::Event::Type;
+        expect(events[0].type == Type::propertyChanged);
+        expect(events[0].path == juce::Array<int>{ 1 });
+        expect(events[0].property == juce::Identifier{ "text" });
+        expectEquals(events[0].value.toString(), juce::String{ "foo" });
+        expect(events[1].type == Type::propertyRemoved);
+        expect(events[2].type == Type::childAdded);
+        expect(events[2].path.isEmpty());
+        expectEquals(events[2].index, 2);
+        expect(events[2].child.hasType("Image"));
+        expect(events[3].type == Type::childMoved);
+        expectEquals(events[3].index, 2);
+        expectEquals(events[3].newIndex, 0);
+        expect(events[4].type == Type::childRemoved);
+        expectEquals(events[4].index, 1);
+
+        for (auto i = 1; i < static_cast<int>(events.size()); i++)
+            expect(events[static_cast<std::size_t>(i)].time >= events[static_cast<std::size_t>(i - 1)].time);
+    }
+
+    void testIgnoredProperties()
+    {
+        beginTest("ignored properties");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "ideal-width", 100 },
+            },
+        };
+        jive::MutationRecorder recorder{ tree };
+        expect(!recorder.getRecording().getInitialState().hasProperty("ideal-width"));
+
+        tree.setProperty("component-size", "0 0 10 10", nullptr);
+        tree.setProperty("on-click",
+                         juce::var{
+                             [](const juce::var::NativeFunctionArgs&) {
+                                 return juce::var{};
+                             },
+                         },
+                         nullptr);
+        expectEquals(static_cast<int>(recorder.getRecording().getEvents().size()), 0);
+
+        recorder.setIgnoredProperties({ "width" });
+        tree.setProperty("width", 10, nullptr);
+        tree.setProperty("ideal-width", 200, nullptr);
+        expectEquals(static_cast<int>(recorder.getRecording().getEvents().size()), 1);
+    }
+
+    void testSerialisation()
+    {
+        beginTest("serialisation");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 123 },
+                { "style", new jive::Object{ { "background", "#FACADE" } } },
+            },
+        };
+        const jive::MutationRecorder recorder{ tree };
+        tree.setProperty("height", 45.6, nullptr);
+        tree.appendChild(juce::ValueTree{ "Text", { { "text", "bar" } } }, nullptr);
+        tree.getChild(0).setProperty("style", new jive::Object{ { "foreground", "#123456" } }, nullptr);
+
+        juce::MemoryOutputStream output;
+        recorder.getRecording().writeToStream(output);
+
+        juce::MemoryInputStream input{ output.getData(), output.getDataSize(), false };
+        const auto recording = jive::MutationRecording::readFromStream(input);
+        expect(recording.has_value());
+        expectEquals(recording->getInitialState()["width"], juce::var{ 123 });
+        expectEquals(juce::VariantConverter<jive::Object::ReferenceCountedPointer>::fromVar(recording->getInitialState()["style"])
+                         ->getProperty("background")
+                         .toString(),
+                     juce::String{ "#FACADE" });
+        expectEquals(static_cast<int>(recording->getEvents().size()), 3);
+        expectEquals(recording->getEvents()[0].value, juce::var{ 45.6 });
+        expect(recording->getEvents()[1].child.isEquivalentTo(juce::ValueTree{ "Text", { { "text", "bar" } } }));
+        expect(recording->getEvents()[2].path == juce::Array<int>{ 0 });
+        expect(recording->getEvents()[2].value.getDynamicObject() != nullptr);
+
+        juce::MemoryInputStream garbage{ "not a recording", 15, false };
+        expect(!jive::MutationRecording::readFromStream(garbage).has_value());
+    }
+
+    void testLongGaps()
+    {
+        beginTest("long gaps");
+
+        // Times are written as deltas in microseconds, which would overflow
+        // an int after about 35 minutes.
+        const juce::ValueTree tree{ "Component", {}, { juce::ValueTree{ "Text" } } };
+        jive::MutationRecording recording{ tree };
+
+        jive::MutationRecording::Event first;
+        first.time = juce::RelativeTime::seconds(1.0);
+        first.property = "width";
+        first.value = 1;
+        recording.addEvent(first);
+
+        jive::MutationRecording::Event second;
+        second.time = first.time + juce::RelativeTime::minutes(40.0);
+        second.path.add(0);
+        second.property = "text";
+        second.value = "foo";
+        recording.addEvent(second);
+
+        jive::MutationRecording::Event third;
+        third.type = jive::MutationRecording::Event::Type::childMoved;
+        third.time = second.time + juce::RelativeTime::hours(2.0);
+        third.index = 0;
+        third.newIndex = 0;
+        recording.addEvent(third);
+
+        juce::MemoryOutputStream output;
+        recording.writeToStream(output);
+
+        juce::MemoryInputStream input{ output.getData(), output.getDataSize(), false };
+        const auto readRecording = jive::MutationRecording::readFromStream(input);
+        expect(readRecording.has_value());
+        expect(readRecording->getInitialState().isEquivalentTo(tree));
+
+        const auto& events = readRecording->getEvents();
+        expectEquals(static_cast<int>(events.size()), 3);
+        expectEquals(events[0].time.inSeconds(), first.time.inSeconds());
+        expectEquals(events[1].time.inSeconds(), second.time.inSeconds());
+        expectEquals(events[2].time.inSeconds(), third.time.inSeconds());
+        expect(events[1].path == juce::Array<int>{ 0 });
+        expectEquals(events[1].value, juce::var{ "foo" });
+        expect(events[2].type == jive::MutationRecording::Event::Type::childMoved);
+        expectEquals(readRecording->getDuration().inSeconds(), third.time.inSeconds());
+    }
+
+    void testMalformedRecordings()
+    {
+        beginTest("malformed recordings");
+
+        // A recording with no events ends with its event count, written as a
+        // single zero byte, so all but that byte is the header and initial
+        // state for the events below to follow.
+        juce::MemoryOutputStream header;
+        jive::MutationRecording{ juce::ValueTree{ "Component" } }.writeToStream(header);
+
+        const auto readWith = [&header](const std::function<void(juce::OutputStream&)>& writeEvents) {
+            juce::MemoryOutputStream output;
+            output.write(header.getData(), header.getDataSize() - 1);
+            writeEvents(output);
+
+            juce::MemoryInputStream input{ output.getData(), output.getDataSize(), false };
+            return jive::MutationRecording::readFromStream(input).has_value();
+        };
+        const auto readChildRemoved = [&readWith](int type, const juce::Array<int>& path, int index) {
+            return readWith([&](juce::OutputStream& stream) {
+                stream.writeCompressedInt(1);
+                stream.writeByte(static_cast<char>(type));
+                stream.writeInt64(0);
+                stream.writeCompressedInt(path.size());
+
+                for (const auto pathIndex : path)
+                    stream.writeCompressedInt(pathIndex);
+
+                stream.writeCompressedInt(index);
+            });
+        };
+        const auto childRemoved = static_cast<int>(jive::MutationRecording::Event::Type::childRemoved);
+
+        expect(readChildRemoved(childRemoved, { 0 }, 0));
+        expect(!readChildRemoved(5, {}, 0));
+        expect(!readChildRemoved(-1, {}, 0));
+        expect(!readChildRemoved(childRemoved, { 0, -2 }, 0));
+        expect(!readChildRemoved(childRemoved, {}, -1));
+
+        expect(!readWith([](juce::OutputStream& stream) {
+            stream.writeCompressedInt(-1);
+        }));
+        expect(!readWith([childRemoved](juce::OutputStream& stream) {
+            stream.writeCompressedInt(1);
+            stream.writeByte(static_cast<char>(childRemoved));
+            stream.writeInt64(0);
+            stream.writeCompressedInt(-1);
+            stream.writeCompressedInt(0);
+        }));
+        expect(!readWith([](juce::OutputStream& stream) {
+            stream.writeCompressedInt(1);
+            stream.writeByte(static_cast<char>(jive::MutationRecording::Event::Type::childAdded));
+            stream.writeInt64(0);
+            stream.writeCompressedInt(0);
+            stream.writeCompressedInt(0);
+            stream.writeString("Text");
+            stream.writeCompressedInt(-1);
+        }));
+    }
+
+    void testReplaying()
+    {
+        beginTest("replaying");
+
+        juce::ValueTree tree{
+            "Component",
+            {},
+            {
+                juce::ValueTree{ "Button" },
+                juce::ValueTree{ "Text" },
+            },
+        };
+        const jive::MutationRecorder recorder{ tree };
+        tree.setProperty("width", 100, nullptr);
+        tree.getChild(0).appendChild(juce::ValueTree{ "Text", { { "text", "Click Me!" } } }, nullptr);
+        tree.moveChild(0, 1, nullptr);
+        tree.getChild(0).removeProperty("id", nullptr);
+        tree.getChild(1).getChild(0).setProperty("text", "Click Me Now!", nullptr);
+        tree.removeChild(0, nullptr);
+
+        auto replayed = recorder.getRecording().getInitialState().createCopy();
+
+        for (const auto& event : recorder.getRecording().getEvents())
+            jive::MutationRecording::apply(event, replayed);
+
+        expect(replayed.isEquivalentTo(tree));
+    }
+};
+
+static MutationRecorderUnitTest mutationRecorderUnitTest;
+#endif
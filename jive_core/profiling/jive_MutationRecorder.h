@@ -0,0 +1,102 @@
+#pragma once
+
+namespace jive
+{
+    /** A sequence of timestamped mutations made to a ValueTree, along with the
+        state of the tree before the first mutation was made.
+
+        Recordings are written in a compact binary format so that sessions
+        captured in a production app can be replayed later, e.g. as
+        performance regression tests.
+    */
+    class MutationRecording
+    {
+    public:
+        struct Event
+        {
+            enum class Type
+            {
+                propertyChanged,
+                propertyRemoved,
+                childAdded,
+                childRemoved,
+                childMoved,
+            };
+
+            Type type = Type::propertyChanged;
+            juce::RelativeTime time;
+
+            // Child indices from the root of the tree to the tree that was
+            // mutated.
+            juce::Array<int> path;
+
+            juce::Identifier property;
+            juce::var value;
+            juce::ValueTree child;
+            int index = -1;
+            int newIndex = -1;
+        };
+
+        MutationRecording() = default;
+        explicit MutationRecording(const juce::ValueTree& initialState);
+
+        [[nodiscard]] const juce::ValueTree& getInitialState() const;
+        [[nodiscard]] const std::vector<Event>& getEvents() const;
+        [[nodiscard]] juce::RelativeTime getDuration() const;
+
+        void addEvent(Event event);
+
+        /** Applies the given event to a tree that's in the same state as the
+            recorded tree was when the event was recorded.
+        */
+        static void apply(const Event& event, juce::ValueTree root);
+
+        void writeToStream(juce::OutputStream& stream) const;
+        bool writeToFile(const juce::File& file) const;
+
+        [[nodiscard]] static std::optional<MutationRecording> readFromStream(juce::InputStream& stream);
+        [[nodiscard]] static std::optional<MutationRecording> readFromFile(const juce::File& file);
+
+    private:
+        juce::ValueTree initialState;
+        std::vector<Event> events;
+
+        JUCE_LEAK_DETECTOR(MutationRecording)
+    };
+
+    /** Records every property change, and every child being added, removed or
+        moved, anywhere within the given tree.
+
+        Properties that JIVE mirrors into the tree while laying out a view
+        (see JIVE_MIRROR_LAYOUT_STATE) are ignored by default, as are values
+        that can't be serialised such as native functions.
+    */
+    class MutationRecorder : private juce::ValueTree::Listener
+    {
+    public:
+        explicit MutationRecorder(juce::ValueTree treeToRecord);
+        ~MutationRecorder() override;
+
+        void setIgnoredProperties(const juce::Array<juce::Identifier>& propertiesToIgnore);
+
+        [[nodiscard]] const MutationRecording& getRecording() const;
+
+    private:
+        void valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id) final;
+        void valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& child) final;
+        void valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree& child, int index) final;
+        void valueTreeChildOrderChanged(juce::ValueTree& parent, int oldIndex, int newIndex) final;
+
+        [[nodiscard]] MutationRecording::Event createEvent(MutationRecording::Event::Type type,
+                                                           const juce::ValueTree& tree) const;
+        [[nodiscard]] juce::ValueTree createSnapshot(const juce::ValueTree& tree) const;
+
+        juce::ValueTree root;
+        const juce::int64 startTicks;
+        juce::Array<juce::Identifier> ignoredProperties;
+        MutationRecording recording;
+
+        JUCE_DECLARE_NON_COPYABLE(MutationRecorder)
+        JUCE_LEAK_DETECTOR(MutationRecorder)
+    };
+} // namespace jive
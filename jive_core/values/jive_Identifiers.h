@@ -0,0 +1,184 @@
+#pragma once
+
+namespace jive
+{
+    /** Identifiers for the properties JIVE itself binds to.
+
+        Creating a juce::Identifier from a string looks the string up in
+        JUCE's global string pool, so each built-in identifier is created once,
+        the first time it's used, rather than every time an item is
+        constructed. They're accessed through functions rather than declared as
+        globals so that they're safe to use while other globals are being
+        initialised, e.g. ids::width().
+    */
+    namespace ids
+    {
+#define JIVE_DECLARE_IDENTIFIER(name, value)               \
+    [[nodiscard]] inline const juce::Identifier& name()    \
+    {                                                      \
+        static const juce::Identifier identifier{ value }; \
+        return identifier;                                 \
+    }
+
+        // Common to every item
+        JIVE_DECLARE_IDENTIFIER(name, "name")
+        JIVE_DECLARE_IDENTIFIER(title, "title")
+        JIVE_DECLARE_IDENTIFIER(id, "id")
+        JIVE_DECLARE_IDENTIFIER(description, "description")
+        JIVE_DECLARE_IDENTIFIER(tooltip, "tooltip")
+        JIVE_DECLARE_IDENTIFIER(enabled, "enabled")
+        JIVE_DECLARE_IDENTIFIER(accessible, "accessible")
+        JIVE_DECLARE_IDENTIFIER(visibility, "visibility")
+        JIVE_DECLARE_IDENTIFIER(alwaysOnTop, "always-on-top")
+        JIVE_DECLARE_IDENTIFIER(bufferedToImage, "buffered-to-image")
+        JIVE_DECLARE_IDENTIFIER(opaque, "opaque")
+        JIVE_DECLARE_IDENTIFIER(focusable, "focusable")
+        JIVE_DECLARE_IDENTIFIER(clickingGrabsFocus, "clicking-grabs-focus")
+        JIVE_DECLARE_IDENTIFIER(focusOutline, "focus-outline")
+        JIVE_DECLARE_IDENTIFIER(focusOrder, "focus-order")
+        JIVE_DECLARE_IDENTIFIER(opacity, "opacity")
+        JIVE_DECLARE_IDENTIFIER(cursor, "cursor")
+        JIVE_DECLARE_IDENTIFIER(display, "display")
+
+        // Box model
+        JIVE_DECLARE_IDENTIFIER(width, "width")
+        JIVE_DECLARE_IDENTIFIER(height, "height")
+        JIVE_DECLARE_IDENTIFIER(minWidth, "min-width")
+        JIVE_DECLARE_IDENTIFIER(minHeight, "min-height")
+        JIVE_DECLARE_IDENTIFIER(maxWidth, "max-width")
+        JIVE_DECLARE_IDENTIFIER(maxHeight, "max-height")
+        JIVE_DECLARE_IDENTIFIER(idealWidth, "ideal-width")
+        JIVE_DECLARE_IDENTIFIER(idealHeight, "ideal-height")
+        JIVE_DECLARE_IDENTIFIER(componentSize, "component-size")
+        JIVE_DECLARE_IDENTIFIER(padding, "padding")
+        JIVE_DECLARE_IDENTIFIER(borderWidth, "border-width")
+        JIVE_DECLARE_IDENTIFIER(margin, "margin")
+
+        // Interaction state
+        JIVE_DECLARE_IDENTIFIER(mouse, "mouse")
+        JIVE_DECLARE_IDENTIFIER(keyboard, "keyboard")
+
+        // Content
+        JIVE_DECLARE_IDENTIFIER(text, "text")
+        JIVE_DECLARE_IDENTIFIER(lineSpacing, "line-spacing")
+        JIVE_DECLARE_IDENTIFIER(justification, "justification")
+        JIVE_DECLARE_IDENTIFIER(wordWrap, "word-wrap")
+        JIVE_DECLARE_IDENTIFIER(direction, "direction")
+        JIVE_DECLARE_IDENTIFIER(source, "source")
+        JIVE_DECLARE_IDENTIFIER(placement, "placement")
+
+        // Block layout
+        JIVE_DECLARE_IDENTIFIER(x, "x")
+        JIVE_DECLARE_IDENTIFIER(y, "y")
+        JIVE_DECLARE_IDENTIFIER(centreX, "centre-x")
+        JIVE_DECLARE_IDENTIFIER(centreY, "centre-y")
+
+        // Flex layout
+        JIVE_DECLARE_IDENTIFIER(order, "order")
+        JIVE_DECLARE_IDENTIFIER(flexGrow, "flex-grow")
+        JIVE_DECLARE_IDENTIFIER(flexShrink, "flex-shrink")
+        JIVE_DECLARE_IDENTIFIER(flexBasis, "flex-basis")
+        JIVE_DECLARE_IDENTIFIER(alignSelf, "align-self")
+        JIVE_DECLARE_IDENTIFIER(flexDirection, "flex-direction")
+        JIVE_DECLARE_IDENTIFIER(flexWrap, "flex-wrap")
+        JIVE_DECLARE_IDENTIFIER(justifyContent, "justify-content")
+        JIVE_DECLARE_IDENTIFIER(alignItems, "align-items")
+        JIVE_DECLARE_IDENTIFIER(alignContent, "align-content")
+
+        // Grid layout
+        JIVE_DECLARE_IDENTIFIER(justifyItems, "justify-items")
+        JIVE_DECLARE_IDENTIFIER(justifySelf, "justify-self")
+        JIVE_DECLARE_IDENTIFIER(gridAutoFlow, "grid-auto-flow")
+        JIVE_DECLARE_IDENTIFIER(gridAutoRows, "grid-auto-rows")
+        JIVE_DECLARE_IDENTIFIER(gridAutoColumns, "grid-auto-columns")
+        JIVE_DECLARE_IDENTIFIER(gridTemplateColumns, "grid-template-columns")
+        JIVE_DECLARE_IDENTIFIER(gridTemplateRows, "grid-template-rows")
+        JIVE_DECLARE_IDENTIFIER(gridTemplateAreas, "grid-template-areas")
+        JIVE_DECLARE_IDENTIFIER(gridColumn, "grid-column")
+        JIVE_DECLARE_IDENTIFIER(gridRow, "grid-row")
+        JIVE_DECLARE_IDENTIFIER(gridArea, "grid-area")
+        JIVE_DECLARE_IDENTIFIER(gap, "gap")
+
+        // Widgets
+        JIVE_DECLARE_IDENTIFIER(value, "value")
+        JIVE_DECLARE_IDENTIFIER(min, "min")
+        JIVE_DECLARE_IDENTIFIER(max, "max")
+        JIVE_DECLARE_IDENTIFIER(mid, "mid")
+        JIVE_DECLARE_IDENTIFIER(interval, "interval")
+        JIVE_DECLARE_IDENTIFIER(orientation, "orientation")
+        JIVE_DECLARE_IDENTIFIER(sensitivity, "sensitivity")
+        JIVE_DECLARE_IDENTIFIER(velocityMode, "velocity-mode")
+        JIVE_DECLARE_IDENTIFIER(velocitySensitivity, "velocity-sensitivity")
+        JIVE_DECLARE_IDENTIFIER(velocityThreshold, "velocity-threshold")
+        JIVE_DECLARE_IDENTIFIER(velocityOffset, "velocity-offset")
+        JIVE_DECLARE_IDENTIFIER(snapToMouse, "snap-to-mouse")
+        JIVE_DECLARE_IDENTIFIER(toggleable, "toggleable")
+        JIVE_DECLARE_IDENTIFIER(toggled, "toggled")
+        JIVE_DECLARE_IDENTIFIER(toggleOnClick, "toggle-on-click")
+        JIVE_DECLARE_IDENTIFIER(radioGroup, "radio-group")
+        JIVE_DECLARE_IDENTIFIER(triggerEvent, "trigger-event")
+        JIVE_DECLARE_IDENTIFIER(selected, "selected")
+        JIVE_DECLARE_IDENTIFIER(editable, "editable")
+        JIVE_DECLARE_IDENTIFIER(url, "url")
+        JIVE_DECLARE_IDENTIFIER(draggable, "draggable")
+
+        // Windows
+        JIVE_DECLARE_IDENTIFIER(shadow, "shadow")
+        JIVE_DECLARE_IDENTIFIER(native, "native")
+        JIVE_DECLARE_IDENTIFIER(resizable, "resizable")
+        JIVE_DECLARE_IDENTIFIER(cornerResizer, "corner-resizer")
+        JIVE_DECLARE_IDENTIFIER(fullScreen, "full-screen")
+        JIVE_DECLARE_IDENTIFIER(minimised, "minimised")
+        JIVE_DECLARE_IDENTIFIER(titleBarHeight, "title-bar-height")
+        JIVE_DECLARE_IDENTIFIER(titleBarButtons, "title-bar-buttons")
+
+        // Events
+        JIVE_DECLARE_IDENTIFIER(onClick, "on-click")
+        JIVE_DECLARE_IDENTIFIER(onChange, "on-change")
+        JIVE_DECLARE_IDENTIFIER(callbacks, "callbacks")
+        JIVE_DECLARE_IDENTIFIER(count, "count")
+        JIVE_DECLARE_IDENTIFIER(time, "time")
+
+        // Styles
+        JIVE_DECLARE_IDENTIFIER(style, "style")
+        JIVE_DECLARE_IDENTIFIER(classes, "class")
+        JIVE_DECLARE_IDENTIFIER(styleSheet, "style-sheet")
+        JIVE_DECLARE_IDENTIFIER(background, "background")
+        JIVE_DECLARE_IDENTIFIER(foreground, "foreground")
+        JIVE_DECLARE_IDENTIFIER(border, "border")
+        JIVE_DECLARE_IDENTIFIER(borderRadius, "border-radius")
+        JIVE_DECLARE_IDENTIFIER(fill, "fill")
+        JIVE_DECLARE_IDENTIFIER(fontFamily, "font-family")
+        JIVE_DECLARE_IDENTIFIER(fontStyle, "font-style")
+        JIVE_DECLARE_IDENTIFIER(fontWeight, "font-weight")
+        JIVE_DECLARE_IDENTIFIER(fontSize, "font-size")
+        JIVE_DECLARE_IDENTIFIER(letterSpacing, "letter-spacing")
+        JIVE_DECLARE_IDENTIFIER(textDecoration, "text-decoration")
+        JIVE_DECLARE_IDENTIFIER(fontStretch, "font-stretch")
+
+#undef JIVE_DECLARE_IDENTIFIER
+    } // namespace ids
+} // namespace jive
+
+// juce::Identifier keeps its name in JUCE's global string pool and compares
+// identifiers by the address of their pooled strings, so equal identifiers
+// always share an address (true of JUCE 6 to 8). Check that still holds
+// before allowing a newer major version of JUCE.
+static_assert(JUCE_MAJOR_VERSION >= 6 && JUCE_MAJOR_VERSION <= 8,
+              "Check that juce::Identifier still pools its strings before hashing it by address");
+
+namespace std
+{
+    /** Hashes Identifiers by the address of their pooled string, which equal
+        identifiers always share, rather than by their characters.
+    */
+    template <>
+    class hash<juce::Identifier>
+    {
+    public:
+        std::size_t operator()(const juce::Identifier& id) const noexcept
+        {
+            return std::hash<const void*>{}(id.getCharPointer().getAddress());
+        }
+    };
+} // namespace std
@@ -17,6 +17,9 @@ public:
         testHereditaryValues();
         testObservations();
         testFunctionalProperties();
+        testCaching();
+        testAccumulation();
+        testDefaults();
     }
 
 private:
@@ -261,6 +264,218 @@ private:
         expect(value.isFunctional());
         expectEquals(value.get(), 300);
     }
+
+    void testCaching()
+    {
+        beginTest("caching");
+
+        {
+            juce::ValueTree tree{ "Tree", { { "value", "row-reverse" } } };
+            jive::Property<juce::FlexBox::Direction> value{ tree, "value" };
+            expect(value.get() == juce::FlexBox::Direction::rowReverse);
+            expect(value.get() == juce::FlexBox::Direction::rowReverse);
+
+            tree.setProperty("value", "column", nullptr);
+            expect(value.get() == juce::FlexBox::Direction::column);
+
+            tree.removeProperty("value", nullptr);
+            expect(value.get() == juce::FlexBox::Direction::row);
+        }
+        {
+            juce::ValueTree root{
+                "Root",
+                {},
+                {
+                    juce::ValueTree{ "Parent", { { "value", 1 } }, { juce::ValueTree{ "Child" } } },
+                    juce::ValueTree{ "Parent", { { "value", 2 } } },
+                },
+            };
+            auto child = root.getChild(0).getChild(0);
+            jive::Property<int, jive::Inheritance::inheritFromParent> value{ child, "value" };
+            expectEquals(value.get(), 1);
+
+            root.getChild(0).removeChild(child, nullptr);
+            expectEquals(value.get(), 0);
+
+            root.getChild(1).appendChild(child, nullptr);
+            expectEquals(value.get(), 2);
+
+            root.getChild(1).setProperty("value", 3, nullptr);
+            expectEquals(value.get(), 3);
+        }
+        {
+            juce::ValueTree root{
+                "Root",
+                { { "value", 1 } },
+                { juce::ValueTree{ "Parent", {}, { juce::ValueTree{ "Child" } } } },
+            };
+            jive::Property<int, jive::Inheritance::inheritFromAncestors> value{
+                root.getChild(0).getChild(0),
+                "value",
+            };
+            expectEquals(value.get(), 1);
+
+            root.getChild(0).setProperty("value", 2, nullptr);
+            expectEquals(value.get(), 2);
+
+            root.getChild(0).removeProperty("value", nullptr);
+            expectEquals(value.get(), 1);
+
+            juce::ValueTree otherRoot{ "Root", { { "value", 4 } } };
+            auto parent = root.getChild(0);
+            root.removeChild(parent, nullptr);
+            expectEquals(value.get(), 0);
+
+            otherRoot.appendChild(parent, nullptr);
+            expectEquals(value.get(), 4);
+
+            otherRoot.setProperty("value", 5, nullptr);
+            expectEquals(value.get(), 5);
+        }
+        {
+            juce::ValueTree state{ "State" };
+            jive::Property<int> value{ state, "value" };
+
+            auto counter = 0;
+            value = [&counter] {
+                return ++counter;
+            };
+            expectEquals(value.get(), 1);
+            expectEquals(value.get(), 2);
+        }
+    }
+
+    void testAccumulation()
+    {
+        beginTest("accumulation");
+
+        juce::ValueTree tree{
+            "Foo",
+            { { "value", 1 } },
+            {
+                juce::ValueTree{ "Bar", { { "value", 10 } }, { juce::ValueTree{ "Baz", { { "value", 100 } } } } },
+                juce::ValueTree{ "Bar", { { "value", 1000 } } },
+            },
+        };
+        const jive::Property<int,
+                             jive::Inheritance::doNotInherit,
+                             jive::Accumulation::accumulate>
+            value{ tree, "value" };
+        expectEquals(value.get(), 1111);
+
+        tree.getChild(0).getChild(0).setProperty("value", 200, nullptr);
+        expectEquals(value.get(), 1211);
+
+        tree.getChild(1).removeProperty("value", nullptr);
+        expectEquals(value.get(), 211);
+
+        tree.getChild(1).appendChild(juce::ValueTree{ "Baz", { { "value", 3000 } } }, nullptr);
+        expectEquals(value.get(), 3211);
+
+        tree.removeChild(0, nullptr);
+        expectEquals(value.get(), 3001);
+
+        juce::ValueTree text{
+            "Text",
+            {},
+            {
+                juce::ValueTree{ "Text", { { "text", "Hello, " } } },
+                juce::ValueTree{ "Text", { { "text", "World!" } } },
+            },
+        };
+        const jive::Property<juce::String,
+                             jive::Inheritance::doNotInherit,
+                             jive::Accumulation::accumulate>
+            concatenated{ text, "text" };
+        expectEquals(concatenated.get(), juce::String{ "Hello, World!" });
+
+        text.moveChild(1, 0, nullptr);
+        expectEquals(concatenated.get(), juce::String{ "World!Hello, " });
+    }
+
+    void testDefaults()
+    {
+        beginTest("defaults");
+
+        {
+            juce::ValueTree tree{ "Tree" };
+            jive::Property<int> value{ tree, "value" };
+            auto numChanges = 0;
+            value.onValueChange = [&numChanges] {
+                numChanges++;
+            };
+            expect(!value.exists());
+
+            value.setDefault(5);
+            expect(value.exists());
+            expect(!tree.hasProperty("value"));
+            expectEquals(value.get(), 5);
+            expectEquals(numChanges, 1);
+
+            tree.setProperty("value", 7, nullptr);
+            expectEquals(value.get(), 7);
+            expectEquals(numChanges, 2);
+
+            tree.removeProperty("value", nullptr);
+            expectEquals(value.get(), 5);
+            expectEquals(numChanges, 3);
+
+            const jive::Property<int> other{ tree, "value" };
+            expectEquals(other.get(), 5);
+        }
+        {
+            juce::ValueTree tree{ "Tree" };
+            jive::Property<int> first{ tree, "value" };
+            jive::Property<int> second{ tree, "value" };
+            auto numChanges = 0;
+            second.onValueChange = [&numChanges] {
+                numChanges++;
+            };
+
+            first.setDefault(1);
+            second.setDefault(2);
+            expectEquals(first.get(), 1);
+            expectEquals(second.get(), 1);
+            expectEquals(numChanges, 1);
+
+            tree.setProperty("value", 3, nullptr);
+            second.setDefault(4);
+            tree.removeProperty("value", nullptr);
+            expectEquals(second.get(), 1);
+        }
+        {
+            juce::ValueTree tree{ "Tree" };
+            jive::Property<int> value{ tree, "value" };
+            value.setDefault(5);
+
+            expect(!tree.hasProperty("value"));
+            expect(tree["value"].isVoid());
+            expect(*jive::PropertyDispatcher::findDefault(tree, "value") == juce::var{ 5 });
+
+            tree.setProperty("value", 6, nullptr);
+            expectEquals(static_cast<int>(tree["value"]), 6);
+            expect(*jive::PropertyDispatcher::findDefault(tree, "value") == juce::var{ 5 });
+        }
+        {
+            juce::ValueTree root{
+                "Root",
+                { { "value", 1 } },
+                { juce::ValueTree{ "Parent", {}, { juce::ValueTree{ "Child" } } } },
+            };
+            jive::Property<int> parent{ root.getChild(0), "value" };
+            jive::Property<int, jive::Inheritance::inheritFromAncestors> child{
+                root.getChild(0).getChild(0),
+                "value",
+            };
+            expectEquals(child.get(), 1);
+
+            parent.setDefault(2);
+            expectEquals(child.get(), 2);
+
+            root.setProperty("value", 3, nullptr);
+            expectEquals(child.get(), 2);
+        }
+    }
 };
 
 static PropertyUnitTest propertyUnitTest;
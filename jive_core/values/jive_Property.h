@@ -1,6 +1,8 @@
 #pragma once
 
 #include "jive_Object.h"
+#include "jive_PropertyDispatcher.h"
+#include "jive_PropertyTransaction.h"
 
 namespace jive
 {
@@ -20,7 +22,9 @@ namespace jive
     template <typename ValueType,
               Inheritance inheritance = Inheritance::doNotInherit,
               Accumulation accumulation = Accumulation::doNotAccumulate>
-    class Property : protected juce::ValueTree::Listener
+    class Property
+        : protected PropertyDispatcher::Subscriber
+        , protected PropertyTransaction::Callback
     {
     public:
         using Converter = juce::VariantConverter<ValueType>;
@@ -28,24 +32,18 @@ namespace jive
         Property(juce::ValueTree sourceTree,
                  const juce::Identifier& propertyID)
             : id{ propertyID }
-            , tree{ sourceTree }
+            , dispatchers{ createDispatchers(sourceTree) }
+            , tree{ getTreeFrom(dispatchers[0]) }
         {
-            switch (inheritance)
+            if (dispatchers[0] != nullptr)
             {
-            case Inheritance::inheritFromParent:
-                treeToListenTo = tree.getParent();
-                break;
-            case Inheritance::inheritFromAncestors:
-                treeToListenTo = tree.getRoot();
-                break;
-            case Inheritance::doNotInherit:
-                treeToListenTo = tree;
-            }
+                dispatchers[0]->subscribe(id, *this, ownScope);
 
-            if (!treeToListenTo.isValid())
-                treeToListenTo = tree;
+                if constexpr (inheritance == Inheritance::inheritFromAncestors)
+                    dispatchers[0]->subscribe(id, *this, PropertyDispatcher::Scope::ancestors);
+            }
 
-            treeToListenTo.addListener(this);
+            updateParentSubscription();
 
             if constexpr (std::is_same<ValueType, Object::ReferenceCountedPointer>())
             {
@@ -58,11 +56,43 @@ namespace jive
         Property(Property&& other) = delete;
         Property& operator=(const Property& other) = delete;
         Property& operator=(Property&& other) = delete;
-        ~Property() override = default;
+
+        ~Property() override
+        {
+            if (dispatchers[0] != nullptr)
+            {
+                dispatchers[0]->unsubscribe(id, *this, ownScope);
+
+                if constexpr (inheritance == Inheritance::inheritFromAncestors)
+                    dispatchers[0]->unsubscribe(id, *this, PropertyDispatcher::Scope::ancestors);
+            }
+
+            if constexpr (inheritance == Inheritance::inheritFromParent)
+            {
+                if (dispatchers[1] != nullptr)
+                    dispatchers[1]->unsubscribe(id, *this, PropertyDispatcher::Scope::tree);
+            }
+        }
 
         [[nodiscard]] virtual ValueType get() const
         {
-            return getFrom(getRootOfInheritance());
+            if constexpr (accumulation == Accumulation::accumulate)
+            {
+                return getFrom(getRootOfInheritance());
+            }
+            else
+            {
+                if (cache.has_value())
+                    return *cache;
+
+                const auto root = getRootOfInheritance();
+                auto value = getFrom(root);
+
+                if (isCacheable(getValue(root)))
+                    cache = value;
+
+                return value;
+            }
         }
 
         [[nodiscard]] auto getOr(const ValueType& valueIfNoneSpecified) const
@@ -70,7 +100,7 @@ namespace jive
             if (auto root = getRootOfInheritance();
                 root.isValid())
             {
-                return getFrom(root);
+                return get();
             }
 
             if constexpr (accumulation == Accumulation::accumulate)
@@ -103,6 +133,22 @@ namespace jive
             tree.setProperty(id, "auto", nullptr);
         }
 
+        /** Sets the value to use whenever the tree doesn't specify one.
+
+            If a default has already been set for this property of this tree,
+            by this or any other Property, that one is kept. The default isn't
+            written to the tree, so reading the tree directly won't see it,
+            and is kept for as long as anything is bound to the tree's
+            property.
+
+            @see PropertyDispatcher::setDefault
+        */
+        void setDefault(const ValueType& defaultValue)
+        {
+            if (dispatchers[0] != nullptr)
+                dispatchers[0]->setDefault(id, Converter::toVar(defaultValue));
+        }
+
         void clear()
         {
             tree.removeProperty(id, nullptr);
@@ -110,17 +156,17 @@ namespace jive
 
         [[nodiscard]] auto exists() const
         {
-            return tree.hasProperty(id);
+            return hasValue(tree);
         }
 
         [[nodiscard]] auto isAuto() const
         {
-            return (!exists()) || tree[id].toString().trim().equalsIgnoreCase("auto");
+            return (!exists()) || getValue(tree).toString().trim().equalsIgnoreCase("auto");
         }
 
         [[nodiscard]] auto isFunctional() const
         {
-            return exists() && tree[id].isMethod();
+            return exists() && getValue(tree).isMethod();
         }
 
         [[nodiscard]] auto toString() const
@@ -128,7 +174,7 @@ namespace jive
             if (!exists())
                 return juce::String{};
 
-            return tree[id].toString();
+            return getValue(tree).toString();
         }
 
         [[nodiscard]] operator ValueType() const
@@ -158,20 +204,47 @@ namespace jive
         std::function<void(void)> onValueChange = nullptr;
 
     protected:
-        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
-                                      const juce::Identifier& property) override
+        void propertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                             const juce::Identifier& property) override
         {
-            if (property != id)
-                return;
-            if (!treeWhosePropertyChanged.hasProperty(property))
-                return;
+            jassert(property == id);
+
             if (!respondToPropertyChanges(treeWhosePropertyChanged))
                 return;
 
+            if constexpr (accumulation == Accumulation::accumulate)
+                invalidateAccumulatedValue(treeWhosePropertyChanged);
+            else
+                cache.reset();
+
+            if (!hasValue(treeWhosePropertyChanged))
+                return;
+
+            if (onValueChange != nullptr && !PropertyTransaction::defer(*this))
+                onValueChange();
+        }
+
+        [[nodiscard]] const juce::ValueTree& getTreeToBatch() const override
+        {
+            return tree;
+        }
+
+        void invokeDeferredCallback() override
+        {
             if (onValueChange != nullptr)
                 onValueChange();
         }
 
+        void structureChanged() override
+        {
+            if constexpr (accumulation == Accumulation::accumulate)
+                cache = AccumulatedValue{};
+            else if constexpr (inheritance != Inheritance::doNotInherit)
+                cache.reset();
+
+            updateParentSubscription();
+        }
+
         [[nodiscard]] auto respondToPropertyChanges(juce::ValueTree& treeWhosePropertyChanged) const
         {
             if (treeWhosePropertyChanged == tree)
@@ -182,7 +255,8 @@ namespace jive
             case Inheritance::inheritFromParent:
                 return treeWhosePropertyChanged == tree.getParent();
             case Inheritance::inheritFromAncestors:
-                return tree.isAChildOf(treeWhosePropertyChanged);
+                // Only ancestors this tree inherits from are dispatched.
+                return true;
             case Inheritance::doNotInherit:
                 break;
             }
@@ -190,7 +264,8 @@ namespace jive
             switch (accumulation)
             {
             case Accumulation::accumulate:
-                return treeWhosePropertyChanged.isAChildOf(tree);
+                // Only changes within this tree are dispatched.
+                return true;
             case Accumulation::doNotAccumulate:
                 break;
             }
@@ -206,7 +281,7 @@ namespace jive
             if constexpr (inheritance == Inheritance::inheritFromParent)
             {
                 if (auto parent = tree.getParent();
-                    parent.hasProperty(id))
+                    hasValue(parent))
                 {
                     return parent;
                 }
@@ -217,7 +292,7 @@ namespace jive
                      ancestor.isValid();
                      ancestor = ancestor.getParent())
                 {
-                    if (ancestor.hasProperty(id))
+                    if (hasValue(ancestor))
                         return ancestor;
                 }
             }
@@ -229,7 +304,7 @@ namespace jive
         {
             for (const auto& child : root)
             {
-                if (child.hasProperty(id))
+                if (hasValue(child))
                     return child;
             }
 
@@ -249,16 +324,11 @@ namespace jive
         {
             if constexpr (accumulation == Accumulation::accumulate)
             {
-                auto result = Converter::fromVar(root[id]);
-
-                for (const auto& child : root)
-                    result += getFrom(child);
-
-                return result;
+                return accumulateFrom(root, cache);
             }
             else
             {
-                auto var = root.hasProperty(id) ? root[id] : getFirstAncestorWithProperty(root).getProperty(id, juce::var{});
+                auto var = hasValue(root) ? getValue(root) : getValue(getFirstAncestorWithProperty(root));
 
                 if (var.isMethod())
                 {
@@ -270,7 +340,176 @@ namespace jive
             }
         }
 
-        juce::ValueTree treeToListenTo;
-        juce::ValueTree tree;
+        [[nodiscard]] bool hasValue(const juce::ValueTree& source) const
+        {
+            return source.hasProperty(id) || findDefault(source) != nullptr;
+        }
+
+        [[nodiscard]] juce::var getValue(const juce::ValueTree& source) const
+        {
+            if (const auto* value = source.getPropertyPointer(id))
+                return *value;
+
+            if (const auto* defaultValue = findDefault(source))
+                return *defaultValue;
+
+            return juce::var{};
+        }
+
+    private:
+        static constexpr auto ownScope = accumulation == Accumulation::accumulate
+                                           ? PropertyDispatcher::Scope::subtree
+                                           : PropertyDispatcher::Scope::tree;
+        static constexpr auto numDispatchers = inheritance == Inheritance::inheritFromParent ? 2 : 1;
+
+        using Dispatchers = std::array<std::shared_ptr<PropertyDispatcher>, numDispatchers>;
+
+        [[nodiscard]] static Dispatchers createDispatchers(const juce::ValueTree& sourceTree)
+        {
+            Dispatchers result;
+
+            if (sourceTree.isValid())
+                result[0] = PropertyDispatcher::getOrCreate(sourceTree);
+
+            return result;
+        }
+
+        [[nodiscard]] static juce::ValueTree& getTreeFrom(const std::shared_ptr<PropertyDispatcher>& dispatcher)
+        {
+            static juce::ValueTree invalidTree;
+
+            if (dispatcher != nullptr)
+                return dispatcher->getTree();
+
+            return invalidTree;
+        }
+
+        [[nodiscard]] const juce::var* findDefault(const juce::ValueTree& source) const
+        {
+            // The property's own dispatchers already have their trees'
+            // defaults to hand.
+            for (const auto& dispatcher : dispatchers)
+            {
+                if (dispatcher != nullptr && dispatcher->getTree() == source)
+                    return dispatcher->getDefault(id);
+            }
+
+            return PropertyDispatcher::findDefault(source, id);
+        }
+
+        void updateParentSubscription()
+        {
+            if constexpr (inheritance == Inheritance::inheritFromParent)
+            {
+                const auto parent = tree.getParent();
+                auto& parentDispatcher = dispatchers[1];
+
+                if (parentDispatcher != nullptr)
+                {
+                    if (parentDispatcher->getTree() == parent)
+                        return;
+
+                    parentDispatcher->unsubscribe(id, *this, PropertyDispatcher::Scope::tree);
+                    parentDispatcher = nullptr;
+                }
+
+                if (!parent.isValid())
+                    return;
+
+                parentDispatcher = PropertyDispatcher::getOrCreate(parent);
+                parentDispatcher->subscribe(id, *this, PropertyDispatcher::Scope::tree);
+            }
+        }
+
+        // Values that can change without the tree being notified can't be
+        // cached: native functions, and objects or arrays that may be mutated
+        // in place.
+        [[nodiscard]] static bool isCacheable(const juce::var& value)
+        {
+            if (value.isMethod())
+                return false;
+
+            if constexpr (std::is_same<ValueType, Object::ReferenceCountedPointer>())
+                return true;
+            else
+                return !value.isObject() && !value.isArray();
+        }
+
+        struct AccumulatedValue
+        {
+            std::optional<ValueType> value;
+            std::vector<AccumulatedValue> children;
+        };
+
+        // Each tree's accumulated value is cached, in the same shape as the
+        // tree, until the property changes on the tree or one of its
+        // descendants, so reading is constant-time and a change only
+        // invalidates the trees between it and this one. Any change to the
+        // structure of the tree clears the whole cache.
+        [[nodiscard]] ValueType accumulateFrom(const juce::ValueTree& root, AccumulatedValue& cached) const
+        {
+            if (cached.value.has_value())
+                return *cached.value;
+
+            const auto value = getValue(root);
+            auto result = Converter::fromVar(value);
+            auto cacheable = isCacheable(value);
+            cached.children.resize(static_cast<std::size_t>(root.getNumChildren()));
+
+            for (auto i = 0; i < root.getNumChildren(); i++)
+            {
+                auto& cachedChild = cached.children[static_cast<std::size_t>(i)];
+                result += accumulateFrom(root.getChild(i), cachedChild);
+                cacheable = cacheable && cachedChild.value.has_value();
+            }
+
+            if (cacheable)
+                cached.value = result;
+
+            return result;
+        }
+
+        AccumulatedValue* invalidateAccumulatedValue(const juce::ValueTree& treeWhosePropertyChanged)
+        {
+            if (treeWhosePropertyChanged == tree)
+            {
+                cache.value.reset();
+                return &cache;
+            }
+
+            const auto parent = treeWhosePropertyChanged.getParent();
+
+            if (!parent.isValid())
+                return nullptr;
+
+            auto* cachedParent = invalidateAccumulatedValue(parent);
+
+            if (cachedParent == nullptr)
+                return nullptr;
+
+            const auto index = static_cast<std::size_t>(parent.indexOf(treeWhosePropertyChanged));
+
+            if (index >= cachedParent->children.size())
+                return nullptr;
+
+            auto& cached = cachedParent->children[index];
+            cached.value.reset();
+            return &cached;
+        }
+
+        // The dispatcher for the property's own tree holds on to the tree,
+        // so the property only needs to refer to it.
+        Dispatchers dispatchers;
+
+    protected:
+        juce::ValueTree& tree;
+
+    private:
+        // Accumulated properties cache the value of each tree they
+        // accumulate, everything else just caches its own value.
+        mutable std::conditional_t<accumulation == Accumulation::accumulate,
+                                   AccumulatedValue,
+                                   std::optional<ValueType>>
+            cache;
     };
 } // namespace jive
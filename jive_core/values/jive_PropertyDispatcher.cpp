@@ -0,0 +1,834 @@
+#include "jive_PropertyDispatcher.h"
+
+namespace jive
+{
+    // juce::ValueTree has no public identity, but each handle is a pointer
+    // to the tree's shared object followed by the handle's own listeners
+    // (true of JUCE 6 to 8), so that pointer identifies the tree for as long
+    // as something, such as its dispatcher, holds on to the tree. The
+    // "sharing" test below fails if a JUCE update changes that.
+    [[nodiscard]] static const void* getIdentity(const juce::ValueTree& tree)
+    {
+        static_assert(sizeof(juce::ValueTree) >= sizeof(void*));
+        static_assert(sizeof(juce::ReferenceCountedObjectPtr<juce::ReferenceCountedObject>) == sizeof(void*));
+
+        const void* identity = nullptr;
+        std::memcpy(&identity, &tree, sizeof(identity));
+        return identity;
+    }
+
+    // Dispatchers can be created from any thread, so the registry is guarded
+    // by a lock. A tree's properties are almost always created together
+    // though, so each thread remembers the last dispatcher it looked up and
+    // only takes the lock when looking up a different tree.
+    struct PropertyDispatcher::Registry
+    {
+        [[nodiscard]] static Registry& get()
+        {
+            static Registry registry;
+            return registry;
+        }
+
+        juce::CriticalSection lock;
+        std::unordered_map<const void*, PropertyDispatcher*> dispatchers;
+    };
+
+    struct LastLookUp
+    {
+        const void* identity = nullptr;
+        std::weak_ptr<PropertyDispatcher> dispatcher;
+    };
+
+    [[nodiscard]] static LastLookUp& getLastLookUp()
+    {
+        thread_local LastLookUp lastLookUp;
+        return lastLookUp;
+    }
+
+    PropertyDispatcher::PropertyDispatcher(const juce::ValueTree& treeToDispatchFor)
+        : tree{ treeToDispatchFor }
+    {
+        tree.addListener(this);
+    }
+
+    PropertyDispatcher::~PropertyDispatcher()
+    {
+        tree.removeListener(this);
+
+        auto& registry = Registry::get();
+        const juce::ScopedLock lock{ registry.lock };
+
+        // A dispatcher may already have replaced this one if the tree was
+        // looked up again while this was being destroyed.
+        if (const auto entry = registry.dispatchers.find(getIdentity(tree));
+            entry != std::end(registry.dispatchers) && entry->second == this)
+        {
+            registry.dispatchers.erase(entry);
+        }
+    }
+
+    std::shared_ptr<PropertyDispatcher> PropertyDispatcher::getOrCreate(const juce::ValueTree& tree)
+    {
+        jassert(tree.isValid());
+
+        return lookUp(tree, true);
+    }
+
+    std::shared_ptr<PropertyDispatcher> PropertyDispatcher::find(const juce::ValueTree& tree)
+    {
+        if (!tree.isValid())
+            return nullptr;
+
+        return lookUp(tree, false);
+    }
+
+    std::shared_ptr<PropertyDispatcher> PropertyDispatcher::lookUp(const juce::ValueTree& tree,
+                                                                   bool createIfNeeded)
+    {
+        const auto identity = getIdentity(tree);
+        auto& lastLookUp = getLastLookUp();
+
+        // While the remembered dispatcher is alive, it holds on to its tree,
+        // so no other tree can have the same identity.
+        if (lastLookUp.identity == identity)
+        {
+            if (auto existing = lastLookUp.dispatcher.lock())
+                return existing;
+        }
+
+        std::shared_ptr<PropertyDispatcher> result;
+
+        {
+            auto& registry = Registry::get();
+            const juce::ScopedLock lock{ registry.lock };
+
+            // Dispatchers are still registered while they're being destroyed.
+            if (const auto entry = registry.dispatchers.find(identity);
+                entry != std::end(registry.dispatchers))
+            {
+                result = entry->second->weak_from_this().lock();
+            }
+
+            if (result == nullptr)
+            {
+                if (!createIfNeeded)
+                    return nullptr;
+
+                result.reset(new PropertyDispatcher{ tree });
+                registry.dispatchers[identity] = result.get();
+            }
+        }
+
+        lastLookUp = { identity, result };
+        return result;
+    }
+
+    void PropertyDispatcher::subscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope)
+    {
+        auto& subscriptions = getSubscriptions(scope);
+        jassert(std::none_of(std::begin(subscriptions),
+                             std::end(subscriptions),
+                             [&](const auto& subscription) {
+                                 return subscription.property == property
+                                     && subscription.subscriber == &subscriber;
+                             }));
+
+        if (scope == Scope::ancestors)
+        {
+            updateRootDispatcher();
+            getRootDispatcher().numInheritingSubscribers[property]++;
+        }
+
+        subscriptions.push_back({ property, &subscriber });
+    }
+
+    void PropertyDispatcher::unsubscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope)
+    {
+        auto& subscriptions = getSubscriptions(scope);
+        const auto subscription = std::find_if(std::begin(subscriptions),
+                                               std::end(subscriptions),
+                                               [&](const auto& entry) {
+                                                   return entry.property == property
+                                                       && entry.subscriber == &subscriber;
+                                               });
+
+        if (subscription == std::end(subscriptions))
+            return;
+
+        if (scope == Scope::ancestors)
+            getRootDispatcher().numInheritingSubscribers[property]--;
+
+        // Subscriptions are only cancelled while they're being dispatched
+        // to, and removed once the dispatch has finished.
+        if (numDispatchesInProgress > 0)
+            subscription->subscriber = nullptr;
+        else
+            subscriptions.erase(subscription);
+    }
+
+    juce::ValueTree& PropertyDispatcher::getTree()
+    {
+        return tree;
+    }
+
+    const juce::ValueTree& PropertyDispatcher::getTree() const
+    {
+        return tree;
+    }
+
+    void PropertyDispatcher::setDefault(const juce::Identifier& property, const juce::var& value)
+    {
+        // As when defaults were written to the tree only if it didn't have
+        // the property yet, the first default set for a property wins.
+        if (!defaults.emplace(property, value).second)
+            return;
+
+        if (!tree.hasProperty(property))
+            notifyDefaultChanged(property);
+    }
+
+    const juce::var* PropertyDispatcher::getDefault(const juce::Identifier& property) const
+    {
+        if (defaults.empty())
+            return nullptr;
+
+        if (const auto entry = defaults.find(property);
+            entry != std::end(defaults))
+        {
+            return &entry->second;
+        }
+
+        return nullptr;
+    }
+
+    const juce::var* PropertyDispatcher::findDefault(const juce::ValueTree& tree,
+                                                     const juce::Identifier& property)
+    {
+        if (const auto dispatcher = find(tree))
+            return dispatcher->getDefault(property);
+
+        return nullptr;
+    }
+
+    void PropertyDispatcher::valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                                      const juce::Identifier& property)
+    {
+        // A subscriber may drop the last reference to this dispatcher.
+        const auto keepAlive = shared_from_this();
+
+        if (treeWhosePropertyChanged == tree)
+            dispatch(Scope::tree, treeWhosePropertyChanged, property);
+
+        dispatch(Scope::subtree, treeWhosePropertyChanged, property);
+
+        if (const auto entry = numInheritingSubscribers.find(property);
+            entry != std::end(numInheritingSubscribers) && entry->second > 0)
+        {
+            propagateToDescendants(treeWhosePropertyChanged, property);
+        }
+    }
+
+    void PropertyDispatcher::propagateToDescendants(juce::ValueTree& treeWhosePropertyChanged,
+                                                    const juce::Identifier& property)
+    {
+        // Only descendants that would inherit the changed property are
+        // visited, i.e. not those that have the property, or a default for
+        // it, themselves, nor any of their descendants.
+        const std::function<void(const juce::ValueTree&)> visitChildren = [&](const juce::ValueTree& parent) {
+            // Subscribers may add or remove children, so the children are
+            // visited by index.
+            for (auto i = 0; i < parent.getNumChildren(); i++)
+            {
+                const auto child = parent.getChild(i);
+                const auto dispatcher = find(child);
+
+                if (child.hasProperty(property)
+                    || (dispatcher != nullptr && dispatcher->getDefault(property) != nullptr))
+                {
+                    continue;
+                }
+
+                if (dispatcher != nullptr)
+                    dispatcher->dispatch(Scope::ancestors, treeWhosePropertyChanged, property);
+
+                visitChildren(child);
+            }
+        };
+
+        visitChildren(treeWhosePropertyChanged);
+    }
+
+    void PropertyDispatcher::dispatch(Scope scope,
+                                      juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property)
+    {
+        auto& subscriptions = getSubscriptions(scope);
+
+        // Subscribers may subscribe while being dispatched to, which can
+        // reallocate the list, so entries are visited by index. Only those
+        // there to begin with are told about the change.
+        const auto numSubscriptions = subscriptions.size();
+        numDispatchesInProgress++;
+
+        for (std::size_t i = 0; i < numSubscriptions; i++)
+        {
+            if (auto* subscriber = subscriptions[i].subscriber;
+                subscriber != nullptr && subscriptions[i].property == property)
+            {
+                subscriber->propertyChanged(treeWhosePropertyChanged, property);
+            }
+        }
+
+        if (--numDispatchesInProgress == 0)
+            removeCancelledSubscriptions();
+    }
+
+    void PropertyDispatcher::removeCancelledSubscriptions()
+    {
+        for (auto* subscriptions : { &treeSubscriptions, &subtreeSubscriptions, &ancestorSubscriptions })
+        {
+            subscriptions->erase(std::remove_if(std::begin(*subscriptions),
+                                                std::end(*subscriptions),
+                                                [](const auto& subscription) {
+                                                    return subscription.subscriber == nullptr;
+                                                }),
+                                 std::end(*subscriptions));
+        }
+    }
+
+    void PropertyDispatcher::notifyDefaultChanged(const juce::Identifier& property)
+    {
+        // Changing a default changes the tree's value just as setting the
+        // property would, so it's dispatched the same way the tree would
+        // dispatch a real change: to this tree's listener, then to each of
+        // its ancestors'.
+        auto treeWhosePropertyChanged = tree;
+        const auto keepAlive = shared_from_this();
+        valueTreePropertyChanged(treeWhosePropertyChanged, property);
+
+        for (auto ancestor = tree.getParent(); ancestor.isValid(); ancestor = ancestor.getParent())
+        {
+            if (const auto dispatcher = find(ancestor))
+                dispatcher->valueTreePropertyChanged(treeWhosePropertyChanged, property);
+        }
+    }
+
+    void PropertyDispatcher::valueTreeChildAdded(juce::ValueTree&, juce::ValueTree&)
+    {
+        notifyStructureChanged(false);
+    }
+
+    void PropertyDispatcher::valueTreeChildRemoved(juce::ValueTree&, juce::ValueTree&, int)
+    {
+        notifyStructureChanged(false);
+    }
+
+    void PropertyDispatcher::valueTreeChildOrderChanged(juce::ValueTree&, int, int)
+    {
+        notifyStructureChanged(false);
+    }
+
+    void PropertyDispatcher::valueTreeParentChanged(juce::ValueTree&)
+    {
+        if (!ancestorSubscriptions.empty())
+            updateRootDispatcher();
+
+        notifyStructureChanged(true);
+    }
+
+    void PropertyDispatcher::notifyStructureChanged(bool includeTreeSubscribers)
+    {
+        const auto keepAlive = shared_from_this();
+
+        // Subscribers typically respond by subscribing elsewhere, so take a
+        // copy rather than iterating the maps they might insert into.
+        std::vector<Subscriber*> subscribersToNotify;
+
+        const auto collect = [&subscribersToNotify](const Subscriptions& subscriptions) {
+            for (const auto& subscription : subscriptions)
+            {
+                if (subscription.subscriber != nullptr)
+                    subscribersToNotify.push_back(subscription.subscriber);
+            }
+        };
+
+        if (includeTreeSubscribers)
+        {
+            collect(treeSubscriptions);
+            collect(ancestorSubscriptions);
+        }
+
+        collect(subtreeSubscriptions);
+
+        for (auto* subscriber : subscribersToNotify)
+            subscriber->structureChanged();
+    }
+
+    PropertyDispatcher& PropertyDispatcher::getRootDispatcher()
+    {
+        if (rootDispatcher != nullptr)
+            return *rootDispatcher;
+
+        return *this;
+    }
+
+    void PropertyDispatcher::updateRootDispatcher()
+    {
+        const auto root = tree.getRoot();
+        auto& previousRootDispatcher = getRootDispatcher();
+
+        if (previousRootDispatcher.tree == root)
+            return;
+
+        const auto keepAlive = std::move(rootDispatcher);
+        rootDispatcher = root == tree ? nullptr : getOrCreate(root);
+        auto& newRootDispatcher = getRootDispatcher();
+
+        for (const auto& subscription : ancestorSubscriptions)
+        {
+            if (subscription.subscriber == nullptr)
+                continue;
+
+            previousRootDispatcher.numInheritingSubscribers[subscription.property]--;
+            newRootDispatcher.numInheritingSubscribers[subscription.property]++;
+        }
+    }
+
+    PropertyDispatcher::Subscriptions& PropertyDispatcher::getSubscriptions(Scope scope)
+    {
+        switch (scope)
+        {
+        case Scope::tree:
+            return treeSubscriptions;
+        case Scope::subtree:
+            return subtreeSubscriptions;
+        case Scope::ancestors:
+            break;
+        }
+
+        return ancestorSubscriptions;
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class PropertyDispatcherUnitTest : public juce::UnitTest
+{
+public:
+    PropertyDispatcherUnitTest()
+        : juce::UnitTest{ "jive::PropertyDispatcher", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testSharing();
+        testFindingMovedTrees();
+        testCreatingFromOtherThreads();
+        testFlatTrees();
+        testDispatching();
+        testScopes();
+        testUnsubscribingDuringDispatch();
+        testSubscribingOthersDuringDispatch();
+        testStructureChanges();
+        testAncestorScope();
+        testDefaults();
+    }
+
+private:
+    struct Counter : public jive::PropertyDispatcher::Subscriber
+    {
+        void propertyChanged(juce::ValueTree&, const juce::Identifier&) override
+        {
+            count++;
+        }
+
+        void structureChanged() override
+        {
+            structureChanges++;
+        }
+
+        int count = 0;
+        int structureChanges = 0;
+    };
+
+    void testSharing()
+    {
+        beginTest("sharing");
+
+        juce::ValueTree tree{ "Tree", {}, { juce::ValueTree{ "Child" } } };
+        const auto dispatcher = jive::PropertyDispatcher::getOrCreate(tree);
+        expect(jive::PropertyDispatcher::getOrCreate(tree) == dispatcher);
+        expect(jive::PropertyDispatcher::getOrCreate(juce::ValueTree{ tree }) == dispatcher);
+        expect(jive::PropertyDispatcher::getOrCreate(tree.getChild(0)) != dispatcher);
+        expect(jive::PropertyDispatcher::getOrCreate(tree.getChild(0))->getTree() == tree.getChild(0));
+        expect(jive::PropertyDispatcher::find(tree.createCopy()) == nullptr);
+
+        // A tree's identity mustn't change as it's modified.
+        tree.setProperty("value", 1, nullptr);
+        tree.appendChild(juce::ValueTree{ "Child" }, nullptr);
+        expect(jive::PropertyDispatcher::find(tree) == dispatcher);
+
+        std::weak_ptr<jive::PropertyDispatcher> weak;
+
+        {
+            const auto temporary = jive::PropertyDispatcher::getOrCreate(tree.getChild(0));
+            weak = temporary;
+        }
+
+        expect(weak.expired());
+    }
+
+    void testFindingMovedTrees()
+    {
+        beginTest("finding moved trees");
+
+        juce::ValueTree root{ "Root", {}, { juce::ValueTree{ "Child", {}, { juce::ValueTree{ "Grandchild" } } } } };
+        juce::ValueTree otherRoot{ "Root" };
+        auto child = root.getChild(0);
+        const auto childDispatcher = jive::PropertyDispatcher::getOrCreate(child);
+        const auto grandchildDispatcher = jive::PropertyDispatcher::getOrCreate(child.getChild(0));
+
+        struct Finder : public juce::ValueTree::Listener
+        {
+            void valueTreeChildAdded(juce::ValueTree&, juce::ValueTree& addedChild) final
+            {
+                found = jive::PropertyDispatcher::find(addedChild);
+            }
+
+            void valueTreeChildRemoved(juce::ValueTree&, juce::ValueTree& removedChild, int) final
+            {
+                found = jive::PropertyDispatcher::find(removedChild);
+            }
+
+            std::shared_ptr<jive::PropertyDispatcher> found;
+        };
+
+        // Listeners of the parents are told before the child's dispatcher.
+        Finder finder;
+        root.addListener(&finder);
+        otherRoot.addListener(&finder);
+
+        root.removeChild(child, nullptr);
+        expect(finder.found == childDispatcher);
+        expect(jive::PropertyDispatcher::find(child) == childDispatcher);
+        expect(jive::PropertyDispatcher::find(child.getChild(0)) == grandchildDispatcher);
+
+        otherRoot.appendChild(child, nullptr);
+        expect(finder.found == childDispatcher);
+        expect(jive::PropertyDispatcher::getOrCreate(child) == childDispatcher);
+        expect(jive::PropertyDispatcher::getOrCreate(child.getChild(0)) == grandchildDispatcher);
+        expect(jive::PropertyDispatcher::find(root.getChild(0)) == nullptr);
+
+        root.removeListener(&finder);
+        otherRoot.removeListener(&finder);
+    }
+
+    void testCreatingFromOtherThreads()
+    {
+        beginTest("creating from other threads");
+
+        const auto createDispatchers = [] {
+            juce::ValueTree tree{ "Tree", {}, { juce::ValueTree{ "Child" } } };
+
+            for (auto i = 0; i < 1000; i++)
+            {
+                const auto dispatcher = jive::PropertyDispatcher::getOrCreate(tree.getChild(0));
+                jassertquiet(dispatcher->getTree() == tree.getChild(0));
+            }
+        };
+
+        std::thread other{ createDispatchers };
+        createDispatchers();
+        other.join();
+
+        juce::ValueTree tree{ "Tree" };
+        expect(jive::PropertyDispatcher::find(tree) == nullptr);
+    }
+
+    void testFlatTrees()
+    {
+        beginTest("flat trees");
+
+        juce::ValueTree tree{ "Tree" };
+        std::vector<std::shared_ptr<jive::PropertyDispatcher>> dispatchers;
+
+        for (auto i = 0; i < 1000; i++)
+        {
+            tree.appendChild(juce::ValueTree{ "Child" }, nullptr);
+            dispatchers.push_back(jive::PropertyDispatcher::getOrCreate(tree.getChild(i)));
+        }
+
+        for (auto i = 0; i < tree.getNumChildren(); i++)
+            expect(jive::PropertyDispatcher::find(tree.getChild(i)) == dispatchers[static_cast<std::size_t>(i)]);
+    }
+
+    void testDispatching()
+    {
+        beginTest("dispatching");
+
+        juce::ValueTree tree{ "Tree" };
+        const auto dispatcher = jive::PropertyDispatcher::getOrCreate(tree);
+
+        Counter width;
+        Counter height;
+        dispatcher->subscribe("width", width, jive::PropertyDispatcher::Scope::tree);
+        dispatcher->subscribe("height", height, jive::PropertyDispatcher::Scope::tree);
+
+        tree.setProperty("width", 10, nullptr);
+        expectEquals(width.count, 1);
+        expectEquals(height.count, 0);
+
+        tree.setProperty("height", 20, nullptr);
+        tree.setProperty("opacity", 0.5, nullptr);
+        expectEquals(width.count, 1);
+        expectEquals(height.count, 1);
+
+        dispatcher->unsubscribe("width", width, jive::PropertyDispatcher::Scope::tree);
+        tree.setProperty("width", 30, nullptr);
+        expectEquals(width.count, 1);
+    }
+
+    void testScopes()
+    {
+        beginTest("scopes");
+
+        juce::ValueTree tree{
+            "Tree",
+            {},
+            {
+                juce::ValueTree{ "Child", {}, { juce::ValueTree{ "Grandchild" } } },
+            },
+        };
+        const auto dispatcher = jive::PropertyDispatcher::getOrCreate(tree);
+
+        Counter treeOnly;
+        Counter subtree;
+        dispatcher->subscribe("value", treeOnly, jive::PropertyDispatcher::Scope::tree);
+        dispatcher->subscribe("value", subtree, jive::PropertyDispatcher::Scope::subtree);
+
+        tree.getChild(0).getChild(0).setProperty("value", 1, nullptr);
+        expectEquals(treeOnly.count, 0);
+        expectEquals(subtree.count, 1);
+
+        tree.setProperty("value", 2, nullptr);
+        expectEquals(treeOnly.count, 1);
+        expectEquals(subtree.count, 2);
+
+        dispatcher->unsubscribe("value", treeOnly, jive::PropertyDispatcher::Scope::tree);
+        dispatcher->unsubscribe("value", subtree, jive::PropertyDispatcher::Scope::subtree);
+    }
+
+    void testUnsubscribingDuringDispatch()
+    {
+        beginTest("unsubscribing during dispatch");
+
+        juce::ValueTree tree{ "Tree" };
+        auto dispatcher = jive::PropertyDispatcher::getOrCreate(tree);
+
+        struct Unsubscriber : public jive::PropertyDispatcher::Subscriber
+        {
+            void propertyChanged(juce::ValueTree&, const juce::Identifier& id) override
+            {
+                dispatcher->unsubscribe(id, *this, jive::PropertyDispatcher::Scope::tree);
+                dispatcher = nullptr;
+                count++;
+            }
+
+            std::shared_ptr<jive::PropertyDispatcher> dispatcher;
+            int count = 0;
+        };
+
+        Unsubscriber unsubscriber;
+        unsubscriber.dispatcher = dispatcher;
+        dispatcher->subscribe("value", unsubscriber, jive::PropertyDispatcher::Scope::tree);
+        dispatcher = nullptr;
+
+        tree.setProperty("value", 1, nullptr);
+        tree.setProperty("value", 2, nullptr);
+        expectEquals(unsubscriber.count, 1);
+    }
+
+    void testSubscribingOthersDuringDispatch()
+    {
+        beginTest("subscribing others during dispatch");
+
+        juce::ValueTree tree{ "Tree" };
+        const auto dispatcher = jive::PropertyDispatcher::getOrCreate(tree);
+
+        struct Swapper : public jive::PropertyDispatcher::Subscriber
+        {
+            void propertyChanged(juce::ValueTree&, const juce::Identifier& id) override
+            {
+                if (count++ > 0)
+                    return;
+
+                dispatcher->unsubscribe(id, *toUnsubscribe, jive::PropertyDispatcher::Scope::tree);
+                dispatcher->subscribe(id, *toSubscribe, jive::PropertyDispatcher::Scope::tree);
+            }
+
+            jive::PropertyDispatcher* dispatcher = nullptr;
+            Counter* toUnsubscribe = nullptr;
+            Counter* toSubscribe = nullptr;
+            int count = 0;
+        };
+
+        Counter unsubscribed;
+        Counter subscribed;
+        Swapper swapper;
+        swapper.dispatcher = dispatcher.get();
+        swapper.toUnsubscribe = &unsubscribed;
+        swapper.toSubscribe = &subscribed;
+        dispatcher->subscribe("value", swapper, jive::PropertyDispatcher::Scope::tree);
+        dispatcher->subscribe("value", unsubscribed, jive::PropertyDispatcher::Scope::tree);
+
+        tree.setProperty("value", 1, nullptr);
+        expectEquals(unsubscribed.count, 0);
+        expectEquals(subscribed.count, 0);
+
+        tree.setProperty("value", 2, nullptr);
+        expectEquals(unsubscribed.count, 0);
+        expectEquals(subscribed.count, 1);
+
+        dispatcher->unsubscribe("value", swapper, jive::PropertyDispatcher::Scope::tree);
+        dispatcher->unsubscribe("value", subscribed, jive::PropertyDispatcher::Scope::tree);
+    }
+
+    void testStructureChanges()
+    {
+        beginTest("structure changes");
+
+        juce::ValueTree root{ "Root", {}, { juce::ValueTree{ "Child" } } };
+        juce::ValueTree otherRoot{ "Root" };
+        auto child = root.getChild(0);
+
+        const auto rootDispatcher = jive::PropertyDispatcher::getOrCreate(root);
+        const auto childDispatcher = jive::PropertyDispatcher::getOrCreate(child);
+
+        Counter rootTree;
+        Counter rootSubtree;
+        Counter childTree;
+        rootDispatcher->subscribe("value", rootTree, jive::PropertyDispatcher::Scope::tree);
+        rootDispatcher->subscribe("value", rootSubtree, jive::PropertyDispatcher::Scope::subtree);
+        childDispatcher->subscribe("value", childTree, jive::PropertyDispatcher::Scope::tree);
+
+        child.appendChild(juce::ValueTree{ "Grandchild" }, nullptr);
+        expectEquals(rootTree.structureChanges, 0);
+        expectEquals(rootSubtree.structureChanges, 1);
+        expectEquals(childTree.structureChanges, 0);
+
+        root.removeChild(child, nullptr);
+        expectEquals(rootTree.structureChanges, 0);
+        expectEquals(rootSubtree.structureChanges, 2);
+        expectEquals(childTree.structureChanges, 1);
+
+        otherRoot.appendChild(child, nullptr);
+        expectEquals(rootSubtree.structureChanges, 2);
+        expectEquals(childTree.structureChanges, 2);
+
+        rootDispatcher->unsubscribe("value", rootTree, jive::PropertyDispatcher::Scope::tree);
+        rootDispatcher->unsubscribe("value", rootSubtree, jive::PropertyDispatcher::Scope::subtree);
+        childDispatcher->unsubscribe("value", childTree, jive::PropertyDispatcher::Scope::tree);
+    }
+
+    void testAncestorScope()
+    {
+        beginTest("ancestor scope");
+
+        juce::ValueTree root{
+            "Root",
+            {},
+            {
+                juce::ValueTree{
+                    "Parent",
+                    {},
+                    {
+                        juce::ValueTree{ "Child", {}, { juce::ValueTree{ "Grandchild" } } },
+                        juce::ValueTree{ "Sibling" },
+                    },
+                },
+            },
+        };
+        auto parent = root.getChild(0);
+        auto child = parent.getChild(0);
+        auto grandchild = child.getChild(0);
+
+        const auto dispatcher = jive::PropertyDispatcher::getOrCreate(grandchild);
+        Counter inheritor;
+        dispatcher->subscribe("value", inheritor, jive::PropertyDispatcher::Scope::ancestors);
+
+        root.setProperty("value", 1, nullptr);
+        expectEquals(inheritor.count, 1);
+
+        parent.getChild(1).setProperty("value", 2, nullptr);
+        grandchild.setProperty("value", 3, nullptr);
+        expectEquals(inheritor.count, 1);
+
+        grandchild.removeProperty("value", nullptr);
+        child.setProperty("value", 4, nullptr);
+        expectEquals(inheritor.count, 2);
+
+        parent.setProperty("value", 5, nullptr);
+        root.setProperty("value", 6, nullptr);
+        expectEquals(inheritor.count, 2);
+
+        child.removeProperty("value", nullptr);
+        expectEquals(inheritor.count, 3);
+
+        juce::ValueTree otherRoot{ "Root" };
+        parent.removeChild(child, nullptr);
+        otherRoot.appendChild(child, nullptr);
+        root.setProperty("value", 7, nullptr);
+        expectEquals(inheritor.count, 3);
+
+        otherRoot.setProperty("value", 8, nullptr);
+        expectEquals(inheritor.count, 4);
+
+        dispatcher->unsubscribe("value", inheritor, jive::PropertyDispatcher::Scope::ancestors);
+        otherRoot.setProperty("value", 9, nullptr);
+        expectEquals(inheritor.count, 4);
+    }
+
+    void testDefaults()
+    {
+        beginTest("defaults");
+
+        juce::ValueTree root{ "Root", {}, { juce::ValueTree{ "Child" } } };
+        auto child = root.getChild(0);
+        const auto rootDispatcher = jive::PropertyDispatcher::getOrCreate(root);
+        const auto childDispatcher = jive::PropertyDispatcher::getOrCreate(child);
+        Counter own;
+        Counter subtree;
+        Counter inheritor;
+        childDispatcher->subscribe("value", own, jive::PropertyDispatcher::Scope::tree);
+        rootDispatcher->subscribe("value", subtree, jive::PropertyDispatcher::Scope::subtree);
+
+        expect(jive::PropertyDispatcher::findDefault(child, "value") == nullptr);
+
+        childDispatcher->setDefault("value", 1);
+        expect(!child.hasProperty("value"));
+        expect(*jive::PropertyDispatcher::findDefault(child, "value") == juce::var{ 1 });
+        expectEquals(own.count, 1);
+        expectEquals(subtree.count, 1);
+
+        childDispatcher->setDefault("value", 1);
+        expectEquals(own.count, 1);
+
+        childDispatcher->setDefault("value", 3);
+        expect(*jive::PropertyDispatcher::findDefault(child, "value") == juce::var{ 1 });
+        expectEquals(own.count, 1);
+
+        child.setProperty("value", 2, nullptr);
+        expectEquals(own.count, 2);
+        expectEquals(subtree.count, 2);
+
+        child.appendChild(juce::ValueTree{ "Grandchild" }, nullptr);
+        const auto grandchildDispatcher = jive::PropertyDispatcher::getOrCreate(child.getChild(0));
+        grandchildDispatcher->subscribe("value", inheritor, jive::PropertyDispatcher::Scope::ancestors);
+        child.removeProperty("value", nullptr);
+        root.setProperty("value", 4, nullptr);
+        expectEquals(inheritor.count, 1);
+    }
+};
+
+static PropertyDispatcherUnitTest propertyDispatcherUnitTest;
+#endif
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "jive_Identifiers.h"
+
+namespace jive
+{
+    /** Dispatches changes to the properties of a single ValueTree to only the
+        subscribers interested in each changed property.
+
+        A dispatcher is shared by everything subscribed to the same tree, so
+        however many properties are bound to a tree, it only ever has the one
+        listener. Dispatchers live for as long as anything holds on to them.
+
+        Dispatchers can be created and found from any thread. As with
+        juce::ValueTree itself though, each tree, and everything bound to it,
+        must only be used from one thread at a time.
+    */
+    class PropertyDispatcher
+        : public std::enable_shared_from_this<PropertyDispatcher>
+        , private juce::ValueTree::Listener
+    {
+    public:
+        struct Subscriber
+        {
+            virtual ~Subscriber() = default;
+
+            virtual void propertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                         const juce::Identifier& property) = 0;
+
+            /** Called when the tree, or one of its ancestors, is moved to a
+                different parent. Subscribers to the whole subtree are also
+                called when a child is added, removed or moved anywhere within
+                it.
+                (Subscribers to the tree's ancestors don't need to be: a
+                tree's ancestors only change when it or one of them moves.)
+
+                Subscribers mustn't destroy other subscribers from here.
+            */
+            virtual void structureChanged() {}
+        };
+
+        enum class Scope
+        {
+            tree,
+            subtree,
+            ancestors,
+        };
+
+        ~PropertyDispatcher() override;
+
+        [[nodiscard]] static std::shared_ptr<PropertyDispatcher> getOrCreate(const juce::ValueTree& tree);
+
+        /** Returns the dispatcher for the given tree, or nullptr if nothing
+            has created one.
+        */
+        [[nodiscard]] static std::shared_ptr<PropertyDispatcher> find(const juce::ValueTree& tree);
+
+        /** Subscribes to changes to the given property of the dispatcher's
+            tree, and also of any of its descendants if the scope is the whole
+            subtree.
+
+            Subscribers to the tree's ancestors are instead told about changes
+            to the nearest ancestor the tree would inherit the property from,
+            i.e. changes made to an ancestor without the tree, or any tree in
+            between, having the property itself.
+
+            Each subscriber should only subscribe once to each property in
+            each scope.
+        */
+        void subscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope);
+
+        /** Subscribers can subscribe and unsubscribe while being told about a
+            change. Those that subscribe then aren't told about that change.
+        */
+        void unsubscribe(const juce::Identifier& property, Subscriber& subscriber, Scope scope);
+
+        [[nodiscard]] juce::ValueTree& getTree();
+        [[nodiscard]] const juce::ValueTree& getTree() const;
+
+        /** Sets the value the given property should be treated as having for
+            as long as the tree doesn't have the property itself.
+
+            Only the first default set for a property takes effect, so later
+            calls for the same property are ignored. Subscribers are told about
+            any change to the value the tree is treated as having, just as
+            though the tree had been changed.
+
+            Defaults are never written to the tree, so code that reads the
+            tree directly (e.g. tree[property] or tree.hasProperty(property))
+            doesn't see them. Read the property through a Property, or fall
+            back to findDefault(), to get the value the tree is treated as
+            having.
+        */
+        void setDefault(const juce::Identifier& property, const juce::var& value);
+
+        /** Returns the default value of the given property of the dispatcher's
+            tree, or nullptr if the tree has no default for the property.
+        */
+        [[nodiscard]] const juce::var* getDefault(const juce::Identifier& property) const;
+
+        /** Returns the default value of the given property of the given tree,
+            or nullptr if the tree has no default for the property.
+
+            Prefer getDefault() where the tree's dispatcher is to hand, as this
+            has to find it first.
+        */
+        [[nodiscard]] static const juce::var* findDefault(const juce::ValueTree& tree,
+                                                          const juce::Identifier& property);
+
+        /** Returns the object of the given type attached to the dispatcher's
+            tree, creating one from the tree if there isn't one yet.
+
+            Attachments are for state that belongs to a tree but shouldn't be
+            written to it. The dispatcher only refers to them, so they live
+            for as long as something else holds on to them.
+        */
+        template <typename Attachment>
+        [[nodiscard]] std::shared_ptr<Attachment> getOrCreateAttachment()
+        {
+            auto& attachment = attachments[typeid(Attachment)];
+
+            if (auto existing = std::static_pointer_cast<Attachment>(attachment.lock()))
+                return existing;
+
+            auto newAttachment = std::make_shared<Attachment>(tree);
+            attachment = newAttachment;
+            return newAttachment;
+        }
+
+        /** Returns the object of the given type attached to the dispatcher's
+            tree, or nullptr if there isn't one.
+        */
+        template <typename Attachment>
+        [[nodiscard]] std::shared_ptr<Attachment> findAttachment() const
+        {
+            if (const auto entry = attachments.find(typeid(Attachment));
+                entry != std::end(attachments))
+            {
+                return std::static_pointer_cast<Attachment>(entry->second.lock());
+            }
+
+            return nullptr;
+        }
+
+    private:
+        struct Subscription
+        {
+            juce::Identifier property;
+            Subscriber* subscriber;
+        };
+
+        // A tree has a few dozen subscriptions at most, so they're kept in a
+        // flat list per scope. A list per property would cost every
+        // subscription a map node and a listener list of its own.
+        using Subscriptions = std::vector<Subscription>;
+
+        struct Registry;
+
+        explicit PropertyDispatcher(const juce::ValueTree& treeToDispatchFor);
+
+        [[nodiscard]] static std::shared_ptr<PropertyDispatcher> lookUp(const juce::ValueTree& tree,
+                                                                        bool createIfNeeded);
+
+        void valueTreePropertyChanged(juce::ValueTree& treeWhosePropertyChanged,
+                                      const juce::Identifier& property) final;
+        void valueTreeChildAdded(juce::ValueTree& parent, juce::ValueTree& child) final;
+        void valueTreeChildRemoved(juce::ValueTree& parent, juce::ValueTree& child, int index) final;
+        void valueTreeChildOrderChanged(juce::ValueTree& parent, int oldIndex, int newIndex) final;
+        void valueTreeParentChanged(juce::ValueTree& treeWhoseParentChanged) final;
+
+        void dispatch(Scope scope,
+                      juce::ValueTree& treeWhosePropertyChanged,
+                      const juce::Identifier& property);
+        void removeCancelledSubscriptions();
+        void notifyStructureChanged(bool includeTreeSubscribers);
+
+        [[nodiscard]] PropertyDispatcher& getRootDispatcher();
+        void updateRootDispatcher();
+        void propagateToDescendants(juce::ValueTree& treeWhosePropertyChanged,
+                                    const juce::Identifier& property);
+        void notifyDefaultChanged(const juce::Identifier& property);
+
+        [[nodiscard]] Subscriptions& getSubscriptions(Scope scope);
+
+        juce::ValueTree tree;
+        Subscriptions treeSubscriptions;
+        Subscriptions subtreeSubscriptions;
+        Subscriptions ancestorSubscriptions;
+        int numDispatchesInProgress = 0;
+        std::unordered_map<juce::Identifier, juce::var> defaults;
+        std::unordered_map<std::type_index, std::weak_ptr<void>> attachments;
+
+        // Changes are only propagated to descendants by the dispatcher of the
+        // root of the tree, which sees every change, and only for properties
+        // something within the tree is inheriting.
+        std::shared_ptr<PropertyDispatcher> rootDispatcher;
+        std::unordered_map<juce::Identifier, int> numInheritingSubscribers;
+
+        JUCE_DECLARE_NON_COPYABLE(PropertyDispatcher)
+        JUCE_LEAK_DETECTOR(PropertyDispatcher)
+    };
+} // namespace jive
@@ -0,0 +1,417 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    // Each thread has its own transactions, so properties changed on other
+    // threads are never deferred by, or race with, the message thread's.
+    [[nodiscard]] static auto& getTransactionsInProgress()
+    {
+        thread_local std::vector<PropertyTransaction*> transactions;
+        return transactions;
+    }
+
+    [[nodiscard]] static int getDepth(juce::ValueTree tree)
+    {
+        auto depth = 0;
+
+        for (tree = tree.getParent(); tree.isValid(); tree = tree.getParent())
+            depth++;
+
+        return depth;
+    }
+
+    PropertyTransaction::Callback::~Callback()
+    {
+        cancel(*this);
+    }
+
+    PropertyTransaction::PropertyTransaction(const juce::ValueTree& treeToBatch)
+        : tree{ treeToBatch }
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        getTransactionsInProgress().push_back(this);
+    }
+
+    PropertyTransaction::~PropertyTransaction()
+    {
+        flush();
+
+        auto& transactions = getTransactionsInProgress();
+        transactions.erase(std::remove(std::begin(transactions),
+                                       std::end(transactions),
+                                       this),
+                           std::end(transactions));
+    }
+
+    bool PropertyTransaction::defer(Callback& callback)
+    {
+        return defer(callback, &PropertyTransaction::pending);
+    }
+
+    bool PropertyTransaction::deferUntilSettled(Callback& callback)
+    {
+        return defer(callback, &PropertyTransaction::settling);
+    }
+
+    bool PropertyTransaction::defer(Callback& callback,
+                                    std::vector<Callback*> PropertyTransaction::*queue)
+    {
+        const auto& transactions = getTransactionsInProgress();
+
+        if (transactions.empty())
+            return false;
+
+        const auto& treeToBatch = callback.getTreeToBatch();
+
+        for (auto* transaction : transactions)
+        {
+            if (!transaction->covers(treeToBatch))
+                continue;
+
+            if (!callback.isPending)
+            {
+                callback.isPending = true;
+                (transaction->*queue).push_back(&callback);
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    void PropertyTransaction::cancel(Callback& callback)
+    {
+        if (!callback.isPending)
+            return;
+
+        for (auto* transaction : getTransactionsInProgress())
+        {
+            std::replace(std::begin(transaction->pending),
+                         std::end(transaction->pending),
+                         &callback,
+                         static_cast<Callback*>(nullptr));
+            std::replace(std::begin(transaction->settling),
+                         std::end(transaction->settling),
+                         &callback,
+                         static_cast<Callback*>(nullptr));
+            std::replace(std::begin(transaction->flushing),
+                         std::end(transaction->flushing),
+                         &callback,
+                         static_cast<Callback*>(nullptr));
+        }
+
+        callback.isPending = false;
+    }
+
+    bool PropertyTransaction::covers(const juce::ValueTree& treeToCheck) const
+    {
+        return treeToCheck == tree || treeToCheck.isAChildOf(tree);
+    }
+
+    void PropertyTransaction::flush()
+    {
+        // Callbacks deferred while flushing are collected into the next
+        // round, so a chain of dependent changes still only invokes each
+        // callback once per round. Settling callbacks only get a round once
+        // every value-change callback has been invoked, so they see all of
+        // the transaction's changes at once.
+        while (!pending.empty() || !settling.empty())
+            flushRound(pending.empty() ? settling : pending);
+    }
+
+    void PropertyTransaction::flushRound(std::vector<Callback*>& queue)
+    {
+        std::vector<std::pair<int, Callback*>> round;
+        round.reserve(queue.size());
+
+        for (auto* callback : queue)
+        {
+            if (callback != nullptr)
+                round.emplace_back(getDepth(callback->getTreeToBatch()), callback);
+        }
+
+        queue.clear();
+        std::stable_sort(std::begin(round),
+                         std::end(round),
+                         [](const auto& a, const auto& b) {
+                             return a.first < b.first;
+                         });
+
+        flushing.clear();
+
+        for (const auto& entry : round)
+            flushing.push_back(entry.second);
+
+        for (std::size_t i = 0; i < flushing.size(); i++)
+        {
+            // Earlier callbacks may have destroyed later ones.
+            if (auto* callback = flushing[i])
+            {
+                callback->isPending = false;
+                flushing[i] = nullptr;
+                callback->invokeDeferredCallback();
+            }
+        }
+
+        flushing.clear();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class PropertyTransactionUnitTest : public juce::UnitTest
+{
+public:
+    PropertyTransactionUnitTest()
+        : juce::UnitTest{ "jive::PropertyTransaction", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCoalescing();
+        testScope();
+        testOrder();
+        testCascades();
+        testSettling();
+        testNesting();
+        testDestroyingDeferredProperties();
+        testOtherThreads();
+    }
+
+private:
+    void testCoalescing()
+    {
+        beginTest("coalescing");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> value{ tree, "value" };
+        juce::Array<int> values;
+        value.onValueChange = [&values, &value] {
+            values.add(value);
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            tree.setProperty("value", 1, nullptr);
+            tree.setProperty("value", 2, nullptr);
+            tree.setProperty("value", 3, nullptr);
+            expect(values.isEmpty());
+            expectEquals(value.get(), 3);
+        }
+
+        expect(values == juce::Array<int>{ 3 });
+
+        tree.setProperty("value", 4, nullptr);
+        expect(values == juce::Array<int>{ 3, 4 });
+    }
+
+    void testScope()
+    {
+        beginTest("scope");
+
+        juce::ValueTree root{
+            "Root",
+            {},
+            {
+                juce::ValueTree{ "Batched", {}, { juce::ValueTree{ "Child" } } },
+                juce::ValueTree{ "NotBatched" },
+            },
+        };
+        jive::Property<int> child{ root.getChild(0).getChild(0), "value" };
+        jive::Property<int> notBatched{ root.getChild(1), "value" };
+        auto numChildChanges = 0;
+        auto numNotBatchedChanges = 0;
+        child.onValueChange = [&numChildChanges] {
+            numChildChanges++;
+        };
+        notBatched.onValueChange = [&numNotBatchedChanges] {
+            numNotBatchedChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ root.getChild(0) };
+            child = 1;
+            notBatched = 1;
+            expectEquals(numChildChanges, 0);
+            expectEquals(numNotBatchedChanges, 1);
+        }
+
+        expectEquals(numChildChanges, 1);
+    }
+
+    void testOrder()
+    {
+        beginTest("order");
+
+        juce::ValueTree root{ "Root", {}, { juce::ValueTree{ "Child" } } };
+        jive::Property<int> child{ root.getChild(0), "value" };
+        jive::Property<int> parent{ root, "value" };
+        juce::StringArray order;
+        child.onValueChange = [&order] {
+            order.add("child");
+        };
+        parent.onValueChange = [&order] {
+            order.add("parent");
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ root };
+            child = 1;
+            parent = 1;
+        }
+
+        expect(order == juce::StringArray{ "parent", "child" });
+    }
+
+    void testCascades()
+    {
+        beginTest("cascades");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> width{ tree, "width" };
+        jive::Property<int> height{ tree, "height" };
+        jive::Property<int> area{ tree, "area" };
+        auto numAreaChanges = 0;
+        const auto updateArea = [&] {
+            area = width * height;
+        };
+        width.onValueChange = updateArea;
+        height.onValueChange = updateArea;
+        area.onValueChange = [&numAreaChanges] {
+            numAreaChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            width = 10;
+            height = 20;
+        }
+
+        expectEquals(area.get(), 200);
+        expectEquals(numAreaChanges, 1);
+    }
+
+    void testSettling()
+    {
+        beginTest("settling");
+
+        struct Settler : public jive::PropertyTransaction::Callback
+        {
+            explicit Settler(const juce::ValueTree& sourceTree)
+                : tree{ sourceTree }
+            {
+            }
+
+            const juce::ValueTree& getTreeToBatch() const final
+            {
+                return tree;
+            }
+
+            void invokeDeferredCallback() final
+            {
+                numInvocations++;
+            }
+
+            juce::ValueTree tree;
+            int numInvocations = 0;
+        };
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> width{ tree, "width" };
+        jive::Property<int> area{ tree, "area" };
+        Settler settler{ tree };
+        auto areaWhenSettled = 0;
+        width.onValueChange = [&] {
+            area = width * 2;
+            expect(jive::PropertyTransaction::deferUntilSettled(settler));
+        };
+        area.onValueChange = [&] {
+            areaWhenSettled = settler.numInvocations == 0 ? area.get() : -1;
+        };
+
+        expect(!jive::PropertyTransaction::deferUntilSettled(settler));
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            width = 10;
+            expect(jive::PropertyTransaction::deferUntilSettled(settler));
+            width = 20;
+            expect(jive::PropertyTransaction::deferUntilSettled(settler));
+        }
+
+        expectEquals(settler.numInvocations, 1);
+        expectEquals(areaWhenSettled, 40);
+    }
+
+    void testNesting()
+    {
+        beginTest("nesting");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> value{ tree, "value" };
+        auto numChanges = 0;
+        value.onValueChange = [&numChanges] {
+            numChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction outer{ tree };
+
+            {
+                const jive::PropertyTransaction inner{ tree };
+                value = 1;
+            }
+
+            expectEquals(numChanges, 0);
+            value = 2;
+        }
+
+        expectEquals(numChanges, 1);
+    }
+
+    void testDestroyingDeferredProperties()
+    {
+        beginTest("destroying deferred properties");
+
+        juce::ValueTree tree{ "Tree" };
+        auto value = std::make_unique<jive::Property<int>>(tree, "value");
+        auto numChanges = 0;
+        value->onValueChange = [&numChanges] {
+            numChanges++;
+        };
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            *value = 1;
+            value = nullptr;
+        }
+
+        expectEquals(numChanges, 0);
+    }
+
+    void testOtherThreads()
+    {
+        beginTest("other threads");
+
+        juce::ValueTree tree{ "Tree" };
+        jive::Property<int> value{ tree, "value" };
+        std::atomic<int> numChanges = 0;
+        value.onValueChange = [&numChanges] {
+            numChanges++;
+        };
+
+        const jive::PropertyTransaction transaction{ tree };
+        std::thread other{ [&tree] {
+            tree.setProperty("value", 1, nullptr);
+        } };
+        other.join();
+        expectEquals(numChanges.load(), 1);
+
+        tree.setProperty("value", 2, nullptr);
+        expectEquals(numChanges.load(), 1);
+    }
+};
+
+static PropertyTransactionUnitTest propertyTransactionUnitTest;
+#endif
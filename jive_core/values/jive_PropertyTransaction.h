@@ -0,0 +1,79 @@
+#pragma once
+
+namespace jive
+{
+    /** Defers the value-change callbacks of any properties bound to the given
+        tree, or any of its descendants, until the transaction is destroyed.
+
+        Each property's callback is invoked at most once however many times
+        its value changed, after all of the transaction's changes have been
+        made. Callbacks are invoked for trees closer to the root first, so a
+        container responds to its own changes before its children respond to
+        theirs. Any changes made by those callbacks are batched in the same
+        way, until there are no more to respond to.
+
+        While a transaction is in progress, anything derived from the batched
+        properties in response to their changes (such as an item's size) will
+        be out of date.
+
+        Work that depends on many properties at once, such as laying out an
+        item, can be deferred until the transaction has settled, in which case
+        it's only done once there are no more value-change callbacks to invoke.
+
+        Transactions can be nested, in which case callbacks are deferred until
+        the outermost transaction covering the changed tree ends.
+
+        Transactions must be created on the message thread, and only defer
+        callbacks for changes made on that thread. Changes made on any other
+        thread are never deferred, and a callback that may have been deferred
+        must be destroyed on the message thread.
+    */
+    class PropertyTransaction
+    {
+    public:
+        struct Callback
+        {
+            virtual ~Callback();
+
+            [[nodiscard]] virtual const juce::ValueTree& getTreeToBatch() const = 0;
+            virtual void invokeDeferredCallback() = 0;
+
+        private:
+            friend class PropertyTransaction;
+
+            bool isPending = false;
+        };
+
+        explicit PropertyTransaction(const juce::ValueTree& treeToBatch);
+        ~PropertyTransaction();
+
+        /** Defers the given callback if its tree is covered by a transaction
+            in progress, returning false if it should be invoked immediately.
+        */
+        [[nodiscard]] static bool defer(Callback& callback);
+
+        /** Defers the given callback until the transaction covering its tree
+            has invoked all of its other callbacks, returning false if there's
+            no such transaction and it should be invoked immediately.
+        */
+        [[nodiscard]] static bool deferUntilSettled(Callback& callback);
+
+        /** Forgets about the given callback if it has been deferred. */
+        static void cancel(Callback& callback);
+
+    private:
+        [[nodiscard]] static bool defer(Callback& callback,
+                                        std::vector<Callback*> PropertyTransaction::*queue);
+        [[nodiscard]] bool covers(const juce::ValueTree& treeToCheck) const;
+        void flush();
+        void flushRound(std::vector<Callback*>& queue);
+
+        const juce::ValueTree tree;
+        std::vector<Callback*> pending;
+        std::vector<Callback*> settling;
+        std::vector<Callback*> flushing;
+
+        JUCE_DECLARE_NON_COPYABLE(PropertyTransaction)
+        JUCE_LEAK_DETECTOR(PropertyTransaction)
+    };
+} // namespace jive
@@ -0,0 +1,171 @@
+#include <jive_core/jive_core.h>
+
+namespace jive
+{
+    PropertyUpdateQueue::Target::Target(std::atomic<bool>& queuePendingFlag,
+                                        const juce::ValueTree& targetTree,
+                                        const juce::Identifier& targetProperty)
+        : queuePending{ queuePendingFlag }
+        , tree{ targetTree }
+        , property{ targetProperty }
+    {
+    }
+
+    void PropertyUpdateQueue::Target::markPending() noexcept
+    {
+        // The target is marked before the queue, so an update that sees the
+        // queue's flag always sees the target's.
+        pending.store(true, std::memory_order_release);
+        queuePending.store(true, std::memory_order_release);
+    }
+
+    void PropertyUpdateQueue::Target::applyPendingUpdate()
+    {
+        // A value posted after the flag is cleared but before it's read will
+        // be applied now and again on the next update, which is harmless as
+        // setting a property to the value it already has does nothing.
+        if (pending.exchange(false, std::memory_order_acq_rel))
+            tree.setProperty(property, getLatestValue(), nullptr);
+    }
+
+    PropertyUpdateQueue::PropertyUpdateQueue(const juce::ValueTree& treeToUpdate, int numUpdatesPerSecond)
+        : tree{ treeToUpdate }
+        , updatesPerSecond{ numUpdatesPerSecond }
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        jassert(updatesPerSecond > 0);
+    }
+
+    PropertyUpdateQueue::~PropertyUpdateQueue()
+    {
+        stopTimer();
+    }
+
+    void PropertyUpdateQueue::applyPendingUpdates()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        if (!pending.exchange(false, std::memory_order_acq_rel))
+            return;
+
+        const PropertyTransaction transaction{ tree };
+
+        for (auto& target : targets)
+            target->applyPendingUpdate();
+    }
+
+    void PropertyUpdateQueue::timerCallback()
+    {
+        applyPendingUpdates();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class PropertyUpdateQueueUnitTest : public juce::UnitTest
+{
+public:
+    PropertyUpdateQueueUnitTest()
+        : juce::UnitTest{ "jive::PropertyUpdateQueue", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testCoalescing();
+        testPostingFromAnotherThread();
+        testBatching();
+    }
+
+private:
+    void testCoalescing()
+    {
+        beginTest("coalescing");
+
+        juce::ValueTree tree{ "Meter" };
+        jive::Property<float> level{ tree, "level" };
+        juce::Array<float> levels;
+        level.onValueChange = [&levels, &level] {
+            levels.add(level);
+        };
+
+        jive::PropertyUpdateQueue queue{ tree };
+        auto& target = queue.addTarget<float>(tree, "level");
+        target.post(0.1f);
+        target.post(0.2f);
+        target.post(0.3f);
+        expect(!tree.hasProperty("level"));
+
+        queue.applyPendingUpdates();
+        expect(levels == juce::Array<float>{ 0.3f });
+
+        queue.applyPendingUpdates();
+        expect(levels == juce::Array<float>{ 0.3f });
+    }
+
+    void testPostingFromAnotherThread()
+    {
+        beginTest("posting from another thread");
+
+        juce::ValueTree tree{ "Meter" };
+        jive::PropertyUpdateQueue queue{ tree };
+        auto& target = queue.addTarget<int>(tree, "count");
+
+        std::atomic<bool> finished{ false };
+        std::thread producer{ [&target, &finished] {
+            for (auto i = 1; i <= 100000; i++)
+                target.post(i);
+
+            finished.store(true);
+        } };
+
+        // Updates are applied while the producer is still posting, and must
+        // only ever move forwards.
+        auto previousCount = 0;
+        auto countOnlyIncreased = true;
+
+        while (!finished.load())
+        {
+            queue.applyPendingUpdates();
+
+            const auto count = static_cast<int>(tree["count"]);
+            countOnlyIncreased = countOnlyIncreased && count >= previousCount;
+            previousCount = count;
+        }
+
+        producer.join();
+        queue.applyPendingUpdates();
+
+        expect(countOnlyIncreased);
+        expectEquals(static_cast<int>(tree["count"]), 100000);
+    }
+
+    void testBatching()
+    {
+        beginTest("batching");
+
+        juce::ValueTree tree{ "Analyser", {}, { juce::ValueTree{ "Band" } } };
+        jive::Property<float> gain{ tree.getChild(0), "gain" };
+        jive::Property<float> frequency{ tree.getChild(0), "frequency" };
+        jive::Property<float> response{ tree.getChild(0), "response" };
+        auto numResponseChanges = 0;
+        const auto updateResponse = [&] {
+            response = gain * frequency;
+        };
+        gain.onValueChange = updateResponse;
+        frequency.onValueChange = updateResponse;
+        response.onValueChange = [&numResponseChanges] {
+            numResponseChanges++;
+        };
+
+        jive::PropertyUpdateQueue queue{ tree };
+        queue.addTarget<float>(tree.getChild(0), "gain").post(2.0f);
+        queue.addTarget<float>(tree.getChild(0), "frequency").post(100.0f);
+        queue.applyPendingUpdates();
+
+        expectEquals(response.get(), 200.0f);
+        expectEquals(numResponseChanges, 1);
+    }
+};
+
+static PropertyUpdateQueueUnitTest propertyUpdateQueueUnitTest;
+#endif
@@ -0,0 +1,125 @@
+#pragma once
+
+namespace jive
+{
+    /** Carries property updates from another thread (such as an audio
+        thread) to a tree on the message thread.
+
+        Each target is bound to a single property of a single tree, and can be
+        posted to from one thread at a time without locking or allocating.
+        Targets only keep their latest value, so however often a producer
+        posts, each target is applied at most once per update. Updates are
+        applied on the message thread at the given rate (once per frame at
+        60Hz by default), all within a single PropertyTransaction over the
+        queue's tree so any properties depending on them only respond once.
+
+        Producers can't safely wake the message thread from a real-time
+        thread, so the queue checks for updates on a timer for as long as it
+        has any targets. Checking a queue with nothing pending only reads a
+        single flag.
+    */
+    class PropertyUpdateQueue : private juce::Timer
+    {
+    public:
+        class Target
+        {
+        public:
+            virtual ~Target() = default;
+
+        protected:
+            Target(std::atomic<bool>& queuePendingFlag,
+                   const juce::ValueTree& targetTree,
+                   const juce::Identifier& targetProperty);
+
+            void markPending() noexcept;
+
+        private:
+            friend class PropertyUpdateQueue;
+
+            void applyPendingUpdate();
+            [[nodiscard]] virtual juce::var getLatestValue() const = 0;
+
+            std::atomic<bool>& queuePending;
+            juce::ValueTree tree;
+            const juce::Identifier property;
+            std::atomic<bool> pending{ false };
+        };
+
+        template <typename ValueType>
+        class TypedTarget : public Target
+        {
+        public:
+            static_assert(std::atomic<ValueType>::is_always_lock_free,
+                          "Values must be able to be posted without locking");
+
+            TypedTarget(std::atomic<bool>& queuePendingFlag,
+                        const juce::ValueTree& targetTree,
+                        const juce::Identifier& targetProperty)
+                : Target{ queuePendingFlag, targetTree, targetProperty }
+            {
+            }
+
+            /** Replaces any value posted since the last update. Safe to call
+                from any one thread at a time.
+            */
+            void post(ValueType newValue) noexcept
+            {
+                value.store(newValue, std::memory_order_release);
+                markPending();
+            }
+
+        private:
+            [[nodiscard]] juce::var getLatestValue() const override
+            {
+                return juce::VariantConverter<ValueType>::toVar(value.load(std::memory_order_acquire));
+            }
+
+            std::atomic<ValueType> value{};
+        };
+
+        explicit PropertyUpdateQueue(const juce::ValueTree& treeToUpdate, int numUpdatesPerSecond = 60);
+        ~PropertyUpdateQueue() override;
+
+        /** Creates a target for posting values of the given property of the
+            given tree, which must be the queue's tree or one of its
+            descendants. The target lives for as long as the queue does.
+
+            Must be called on the message thread.
+        */
+        template <typename ValueType>
+        TypedTarget<ValueType>& addTarget(const juce::ValueTree& targetTree,
+                                          const juce::Identifier& targetProperty)
+        {
+            JUCE_ASSERT_MESSAGE_THREAD
+            jassert(targetTree == tree || targetTree.isAChildOf(tree));
+
+            auto target = std::make_unique<TypedTarget<ValueType>>(pending, targetTree, targetProperty);
+            auto& result = *target;
+            targets.push_back(std::move(target));
+
+            if (!isTimerRunning())
+                startTimerHz(updatesPerSecond);
+
+            return result;
+        }
+
+        /** Applies any pending updates immediately, rather than waiting for
+            the next scheduled update.
+        */
+        void applyPendingUpdates();
+
+    private:
+        void timerCallback() final;
+
+        const juce::ValueTree tree;
+        const int updatesPerSecond;
+        std::vector<std::unique_ptr<Target>> targets;
+
+        // Set whenever any target is posted to, so an update with nothing to
+        // apply doesn't have to visit every target.
+        std::atomic<bool> pending{ false };
+
+        JUCE_DECLARE_NON_COPYABLE(PropertyUpdateQueue)
+        JUCE_LEAK_DETECTOR(PropertyUpdateQueue)
+    };
+} // namespace jive
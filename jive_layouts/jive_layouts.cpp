@@ -32,3 +32,4 @@
 #include "layout/gui-items/widgets/jive_Spinner.cpp"
 
 #include "layout/jive_Interpreter.cpp"
+#include "layout/jive_LayoutScheduler.cpp"
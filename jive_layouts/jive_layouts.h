@@ -57,3 +57,4 @@ namespace jive
 #include "layout/gui-items/widgets/jive_Spinner.h"
 
 #include "layout/jive_Interpreter.h"
+#include "layout/jive_LayoutScheduler.h"
@@ -5,12 +5,13 @@ namespace jive
     BlockContainer::BlockContainer(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem{ std::move(itemToDecorate) }
     {
-        jassert(state.hasProperty("display"));
-        jassert(state["display"] == juce::VariantConverter<Display>::toVar(Display::block));
+        jassert(Property<Display>(state, ids::display()).get() == Display::block);
     }
 
     void BlockContainer::layOutChildren()
     {
+        JIVE_INSTRUMENT_PHASE(layout);
+
         GuiItemDecorator::layOutChildren();
 
         for (auto child : getChildren())
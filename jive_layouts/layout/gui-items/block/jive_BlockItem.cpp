@@ -4,12 +4,12 @@ namespace jive
 {
     BlockItem::BlockItem(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , x{ state, "x" }
-        , y{ state, "y" }
-        , centreX{ state, "centre-x" }
-        , centreY{ state, "centre-y" }
-        , width{ state, "width" }
-        , height{ state, "height" }
+        , x{ state, ids::x() }
+        , y{ state, ids::y() }
+        , centreX{ state, ids::centreX() }
+        , centreY{ state, ids::centreY() }
+        , width{ state, ids::width() }
+        , height{ state, ids::height() }
         , boxModel{ toType<CommonGuiItem>()->boxModel }
     {
         jassert(getParent() != nullptr);
@@ -4,18 +4,15 @@ namespace jive
 {
     Image::Image(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , source{ state, "source" }
-        , placement{ state, "placement" }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
+        , source{ state, ids::source() }
+        , placement{ state, ids::placement() }
+        , width{ state, ids::width() }
+        , height{ state, ids::height() }
         , boxModel{ toType<CommonGuiItem>()->boxModel }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ jive::boxModel(*this) };
 
-        if (!placement.exists())
-            placement = juce::RectanglePlacement::centred;
+        placement.setDefault(juce::RectanglePlacement::centred);
 
         source.onValueChange = [this]() {
             setChildComponent(createChildComponent());
@@ -84,8 +81,8 @@ namespace jive
         if (childComponent != nullptr)
             childComponent->setBounds(component->getLocalBounds());
 
-        idealWidth = juce::String{ calculateRequiredWidth() };
-        idealHeight = juce::String{ calculateRequiredHeight() };
+        boxModel.setIdealWidth(calculateRequiredWidth());
+        boxModel.setIdealHeight(calculateRequiredHeight());
     }
 
     void Image::valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&)
@@ -217,8 +214,8 @@ namespace jive
         component->addAndMakeVisible(*childComponent);
         childComponent->setBounds(component->getLocalBounds());
 
-        idealWidth = juce::String{ calculateRequiredWidth() };
-        idealHeight = juce::String{ calculateRequiredHeight() };
+        boxModel.setIdealWidth(calculateRequiredWidth());
+        boxModel.setIdealHeight(calculateRequiredHeight());
 
         component->addComponentListener(this);
     }
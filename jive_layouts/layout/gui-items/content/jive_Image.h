@@ -43,10 +43,8 @@ namespace jive
         Property<juce::RectanglePlacement> placement;
         Length width;
         Length height;
-        Length idealWidth;
-        Length idealHeight;
 
-        const BoxModel& boxModel;
+        BoxModel& boxModel;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Image)
     };
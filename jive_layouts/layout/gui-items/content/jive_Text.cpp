@@ -4,22 +4,17 @@ namespace jive
 {
     Text::Text(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , text{ state, "text" }
-        , lineSpacing{ state, "line-spacing" }
-        , justification{ state, "justification" }
-        , wordWrap{ state, "word-wrap" }
-        , direction{ state, "direction" }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
+        , text{ state, ids::text() }
+        , lineSpacing{ state, ids::lineSpacing() }
+        , justification{ state, ids::justification() }
+        , wordWrap{ state, ids::wordWrap() }
+        , direction{ state, ids::direction() }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
-        if (!justification.exists())
-            justification = juce::Justification::centredLeft;
-        if (!wordWrap.exists())
-            wordWrap = juce::AttributedString::WordWrap::byWord;
-        if (!direction.exists())
-            direction = juce::AttributedString::ReadingDirection::natural;
+        justification.setDefault(juce::Justification::centredLeft);
+        wordWrap.setDefault(juce::AttributedString::WordWrap::byWord);
+        direction.setDefault(juce::AttributedString::ReadingDirection::natural);
 
         text.onValueChange = [this]() {
             updateTextComponent();
@@ -37,13 +32,6 @@ namespace jive
             updateTextComponent();
         };
 
-        state.setProperty("ideal-height",
-                          juce::var{ [this](const juce::var::NativeFunctionArgs& args) {
-                              const auto layout = buildTextLayout(args.arguments[0]);
-                              return std::ceil(layout.getHeight());
-                          } },
-                          nullptr);
-
         updateTextComponent();
         getTextComponent().addListener(*this);
     }
@@ -75,6 +63,11 @@ namespace jive
         return true;
     }
 
+    std::optional<float> Text::measureHeightForWidth(float width) const
+    {
+        return std::ceil(buildTextLayout(width).getHeight());
+    }
+
     TextComponent& Text::getTextComponent()
     {
         return dynamic_cast<TextComponent&>(*component);
@@ -134,15 +127,16 @@ namespace jive
             }
         }
 
-        idealWidth = std::ceil(buildTextLayout(static_cast<float>(std::numeric_limits<juce::uint16>::max()))
-                                   .getWidth());
+        boxModel(*this).setIdealWidth(std::ceil(buildTextLayout(static_cast<float>(std::numeric_limits<juce::uint16>::max()))
+                                                    .getWidth()));
+        boxModel(*this).intrinsicSizeChanged();
 
         if (auto* parentItem = getParent())
         {
             if (!parentItem->isContainer())
                 getTextComponent().setAccessible(false);
             else
-                parentItem->state.setProperty("box-model-valid", false, nullptr);
+                boxModel(*parentItem).invalidate();
         }
     }
 
@@ -15,6 +15,7 @@ namespace jive
 
         bool isContainer() const override;
         bool isContent() const override;
+        std::optional<float> measureHeightForWidth(float width) const override;
 
         TextComponent& getTextComponent();
         const TextComponent& getTextComponent() const;
@@ -31,8 +32,6 @@ namespace jive
         Property<juce::Justification> justification;
         Property<juce::AttributedString::WordWrap> wordWrap;
         Property<juce::AttributedString::ReadingDirection> direction;
-        Property<float> idealWidth;
-        Property<float> idealHeight;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(Text)
     };
@@ -4,18 +4,16 @@ namespace jive
 {
     FlexContainer::FlexContainer(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem{ std::move(itemToDecorate) }
-        , flexDirection{ state, "flex-direction" }
-        , flexWrap{ state, "flex-wrap" }
-        , flexJustifyContent{ state, "justify-content" }
-        , flexAlignItems{ state, "align-items" }
-        , flexAlignContent{ state, "align-content" }
+        , flexDirection{ state, ids::flexDirection() }
+        , flexWrap{ state, ids::flexWrap() }
+        , flexJustifyContent{ state, ids::justifyContent() }
+        , flexAlignItems{ state, ids::alignItems() }
+        , flexAlignContent{ state, ids::alignContent() }
         , boxModel{ toType<CommonGuiItem>()->boxModel }
     {
-        jassert(state.hasProperty("display"));
-        jassert(state["display"] == juce::VariantConverter<Display>::toVar(Display::flex));
+        jassert(Property<Display>(state, ids::display()).get() == Display::flex);
 
-        if (!flexDirection.exists())
-            flexDirection = juce::FlexBox::Direction::column;
+        flexDirection.setDefault(juce::FlexBox::Direction::column);
 
         flexDirection.onValueChange = [this]() {
             layoutChanged();
@@ -32,13 +30,6 @@ namespace jive
         flexAlignContent.onValueChange = [this]() {
             layoutChanged();
         };
-
-        state.addListener(this);
-    }
-
-    FlexContainer::~FlexContainer()
-    {
-        state.removeListener(this);
     }
 
     void FlexContainer::layOutChildren()
@@ -47,6 +38,7 @@ namespace jive
             return;
 
         const juce::ScopedValueSetter svs{ layoutRecursionLock, true };
+        JIVE_INSTRUMENT_PHASE(layout);
 
         GuiItemDecorator::layOutChildren();
 
@@ -55,22 +47,51 @@ namespace jive
         if (bounds.getWidth() <= 0 || bounds.getHeight() <= 0)
             return;
 
-        do
+        // Children's ideal sizes can change as a result of the sizes they're
+        // given, so lay them out again until they settle. Children whose
+        // height depends on their width are measured at the width they're
+        // given, so that's usually a single pass to lay them out and one to
+        // confirm nothing changed.
+        for (auto pass = 0;; pass++)
         {
-            changesDuringLayout = false;
-            buildFlexBox(bounds, LayoutStrategy::real)
-                .performLayout(bounds);
+            JIVE_INSTRUMENT_PHASE(layoutPass);
+
+            // A layout that hasn't settled by now is probably oscillating
+            // between two sizes.
+            jassert(pass != 16);
+
+            const auto versionsBefore = getIntrinsicSizeVersions();
+            buildFlexBox(flexBox, bounds, LayoutStrategy::real);
+            flexBox.performLayout(bounds);
+
+            if (getIntrinsicSizeVersions() == versionsBefore)
+                break;
         }
-        while (changesDuringLayout);
     }
 
     FlexContainer::operator juce::FlexBox()
     {
-        return buildFlexBox(boxModel.getContentBounds(), LayoutStrategy::real);
+        juce::FlexBox flex;
+        buildFlexBox(flex, boxModel.getContentBounds(), LayoutStrategy::real);
+        return flex;
+    }
+
+    const juce::Array<juce::Identifier>& FlexContainer::getLayoutPropertyIDs() const
+    {
+        static const juce::Array<juce::Identifier> layoutPropertyIDs{
+            ids::flexDirection(),
+            ids::flexWrap(),
+            ids::justifyContent(),
+            ids::alignItems(),
+            ids::alignContent(),
+        };
+        return layoutPropertyIDs;
     }
 
     juce::Rectangle<float> FlexContainer::calculateIdealSize(juce::Rectangle<float> constraints) const
     {
+        JIVE_INSTRUMENT_PHASE(idealSizeCalculation);
+
         constraints = constraints.withZeroOrigin();
 
         switch (flexDirection.getOr(juce::FlexBox{}.flexDirection))
@@ -87,13 +108,12 @@ namespace jive
             jassertfalse;
         }
 
-        auto flex = const_cast<FlexContainer&>(*this)
-                        .buildFlexBox(constraints, LayoutStrategy::dummy);
-        flex.performLayout(constraints);
+        buildFlexBox(measurementFlexBox, constraints, LayoutStrategy::dummy);
+        measurementFlexBox.performLayout(constraints);
 
         juce::Point extremities{ -1.0f, -1.0f };
 
-        for (const auto& flexItem : flex.items)
+        for (const auto& flexItem : measurementFlexBox.items)
         {
             const auto right = flexItem.currentBounds.getRight() + flexItem.margin.right;
             const auto bottom = flexItem.currentBounds.getBottom() + flexItem.margin.bottom;
@@ -122,47 +142,31 @@ namespace jive
         };
     }
 
-    static void appendChildren(GuiItem& container,
+    static void appendChildren(const GuiItem& container,
                                juce::FlexBox& flex,
                                juce::Rectangle<float> bounds,
+                               Orientation orientation,
                                LayoutStrategy strategy)
     {
-        for (auto* child : container.getChildren())
+        for (const auto* child : container.getChildren())
         {
-            if (auto* const decoratedItem = dynamic_cast<GuiItemDecorator*>(child))
+            if (const auto* const decoratedItem = dynamic_cast<const GuiItemDecorator*>(child))
             {
-                if (auto* const flexItem = decoratedItem->toType<FlexItem>())
-                    flex.items.add(flexItem->toJuceFlexItem(bounds, strategy));
+                if (const auto* const flexItem = decoratedItem->toType<FlexItem>())
+                    flex.items.add(flexItem->toJuceFlexItem(bounds, orientation, strategy));
             }
         }
     }
 
-    void FlexContainer::valueTreePropertyChanged(juce::ValueTree& tree, const juce::Identifier& id)
+    void FlexContainer::buildFlexBox(juce::FlexBox& flex,
+                                     juce::Rectangle<float> bounds,
+                                     LayoutStrategy strategy) const
     {
-        if (tree != state && tree.getParent() != state)
-            return;
-
-        if (layoutRecursionLock)
-        {
-            static const juce::Array<juce::Identifier> propertiesForWhichChangesRequireAnotherLayOut{
-                "ideal-width",
-                "ideal-height",
-            };
-
-            if (propertiesForWhichChangesRequireAnotherLayOut.contains(id))
-                changesDuringLayout = true;
-        }
-    }
-
-    juce::FlexBox FlexContainer::buildFlexBox(juce::Rectangle<float> bounds,
-                                              LayoutStrategy strategy)
-    {
-        juce::FlexBox flex;
-
         flex.flexDirection = flexDirection;
         flex.flexWrap = flexWrap;
 
-        appendChildren(*this, flex, bounds, strategy);
+        flex.items.clearQuick();
+        appendChildren(*this, flex, bounds, getOrientation(), strategy);
 
         switch (strategy)
         {
@@ -179,8 +183,28 @@ namespace jive
         default:
             jassertfalse;
         }
+    }
 
-        return flex;
+    Orientation FlexContainer::getOrientation() const
+    {
+        const auto direction = flexDirection.get();
+
+        if (direction == juce::FlexBox::Direction::row || direction == juce::FlexBox::Direction::rowReverse)
+            return Orientation::horizontal;
+
+        return Orientation::vertical;
+    }
+
+    // The versions only ever increase, so their sum changes whenever any one
+    // of them does.
+    juce::uint32 FlexContainer::getIntrinsicSizeVersions() const
+    {
+        auto versions = boxModel.getIntrinsicSizeVersion();
+
+        for (const auto* child : getChildren())
+            versions += jive::boxModel(*child).getIntrinsicSizeVersion();
+
+        return versions;
     }
 } // namespace jive
 
@@ -204,6 +228,7 @@ public:
         testPadding();
         testAutoSize();
         testNestedWidgetWithText();
+        testSettlingNestedText();
     }
 
 private:
@@ -616,6 +641,58 @@ private:
             expectEquals(boxModel.getContentBounds().getHeight(), std::ceil(layout.getHeight()));
         }
     }
+
+    void testSettlingNestedText()
+    {
+        beginTest("settling nested text");
+
+        const juce::Font font;
+        const juce::String text = "Lorem ipsum dolor sit amet, consectetur adipiscing elit.";
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 150 },
+                { "height", 1000 },
+                { "align-items", "stretch" },
+            },
+            {
+                juce::ValueTree{
+                    "Component",
+                    { { "padding", 10 } },
+                    {
+                        juce::ValueTree{
+                            "Component",
+                            {},
+                            {
+                                juce::ValueTree{
+                                    "Text",
+                                    {
+                                        { "text", text },
+                                        { "typeface-name", font.getTypefaceName() },
+                                        { "font-height", font.getHeightInPoints() },
+                                    },
+                                },
+                            },
+                        },
+                    },
+                },
+            },
+        };
+        const jive::Interpreter interpreter;
+        const auto item = interpreter.interpret(state);
+
+        // The text wraps at the width its grandparent gives it, and both of
+        // its ancestors grow to fit it, however many passes that takes.
+        juce::TextLayout layout;
+        layout.createLayout(juce::AttributedString{ text }, 130.0f);
+        const auto textHeight = std::ceil(layout.getHeight());
+
+        const auto& outer = *item->getChildren()[0];
+        const auto& inner = *outer.getChildren()[0];
+        expectEquals(jive::boxModel(inner).getWidth(), 130.0f);
+        expectEquals(jive::boxModel(inner).getHeight(), textHeight);
+        expectEquals(jive::boxModel(outer).getHeight(), textHeight + 20.0f);
+    }
 };
 
 static FlexContainerUnitTest flexContainerUnitTest;
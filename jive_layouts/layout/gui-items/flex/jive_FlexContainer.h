@@ -2,13 +2,10 @@
 
 namespace jive
 {
-    class FlexContainer
-        : public ContainerItem
-        , private juce::ValueTree::Listener
+    class FlexContainer : public ContainerItem
     {
     public:
         explicit FlexContainer(std::unique_ptr<GuiItem> itemToDecorate);
-        ~FlexContainer() override;
 
         void layOutChildren() override;
 
@@ -16,11 +13,14 @@ namespace jive
 
     protected:
         juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const override;
+        const juce::Array<juce::Identifier>& getLayoutPropertyIDs() const override;
 
     private:
-        void valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier&) final;
-
-        juce::FlexBox buildFlexBox(juce::Rectangle<float> bounds, LayoutStrategy strategy);
+        void buildFlexBox(juce::FlexBox& flex,
+                          juce::Rectangle<float> bounds,
+                          LayoutStrategy strategy) const;
+        [[nodiscard]] Orientation getOrientation() const;
+        [[nodiscard]] juce::uint32 getIntrinsicSizeVersions() const;
 
         Property<juce::FlexBox::Direction> flexDirection;
         Property<juce::FlexBox::Wrap> flexWrap;
@@ -28,8 +28,12 @@ namespace jive
         Property<juce::FlexBox::AlignItems> flexAlignItems;
         Property<juce::FlexBox::AlignContent> flexAlignContent;
 
+        // Kept between layouts so their items' storage can be reused rather
+        // than reallocated for every pass.
+        juce::FlexBox flexBox;
+        mutable juce::FlexBox measurementFlexBox;
+
         bool layoutRecursionLock = false;
-        bool changesDuringLayout = false;
 
         const BoxModel& boxModel;
 
@@ -4,17 +4,17 @@ namespace jive
 {
     FlexItem::FlexItem(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem::Child{ std::move(itemToDecorate) }
-        , order{ state, "order" }
-        , flexGrow{ state, "flex-grow" }
-        , flexShrink{ state, "flex-shrink" }
-        , flexBasis{ state, "flex-basis" }
-        , alignSelf{ state, "align-self" }
+        , order{ state, ids::order() }
+        , flexGrow{ state, ids::flexGrow() }
+        , flexShrink{ state, ids::flexShrink() }
+        , flexBasis{ state, ids::flexBasis() }
+        , alignSelf{ state, ids::alignSelf() }
     {
-        if (!flexShrink.exists())
-            flexShrink = juce::FlexItem{}.flexShrink;
+        flexShrink.setDefault(juce::FlexItem{}.flexShrink);
 
         const auto updateParentLayout = [this]() {
-            getParent()->layOutChildren();
+            boxModel(*this).intrinsicSizeChanged();
+            LayoutScheduler::requestLayout(*getParent());
         };
         order.onValueChange = updateParentLayout;
         flexGrow.onValueChange = updateParentLayout;
@@ -24,6 +24,7 @@ namespace jive
     }
 
     juce::FlexItem FlexItem::toJuceFlexItem(juce::Rectangle<float> parentContentBounds,
+                                            Orientation parentOrientation,
                                             LayoutStrategy strategy) const
     {
         juce::FlexItem flexItem{ *component };
@@ -35,21 +36,9 @@ namespace jive
         if (strategy == LayoutStrategy::real)
             flexItem.alignSelf = alignSelf;
 
-        const auto orientation = [this]() {
-            const Property<juce::FlexBox::Direction> parentDirection{
-                state.getParent(),
-                "flex-direction",
-            };
-            const auto direction = parentDirection.get();
-
-            if (direction == juce::FlexBox::Direction::row || direction == juce::FlexBox::Direction::rowReverse)
-                return Orientation::horizontal;
-
-            return Orientation::vertical;
-        };
         applyConstraints(flexItem,
                          parentContentBounds,
-                         orientation(),
+                         parentOrientation,
                          strategy);
 
         return flexItem;
@@ -98,7 +87,7 @@ private:
         auto& item = *parent->getChildren()[0];
         const auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                                   .toType<jive::FlexItem>()
-                                  ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                                  ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
         expect(flexItem.associatedComponent == item.getComponent().get());
     }
 
@@ -121,14 +110,14 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.order == 0);
 
         state.getChild(0).setProperty("order", 10, nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.order == 10);
     }
@@ -152,14 +141,14 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.flexGrow == 0.f);
 
         state.getChild(0).setProperty("flex-grow", 5.f, nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.flexGrow == 5.f);
     }
@@ -183,14 +172,14 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.flexShrink == 1.f);
 
         state.getChild(0).setProperty("flex-shrink", 3.4f, nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expectEquals(flexItem.flexShrink, 3.4f);
     }
@@ -214,14 +203,14 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.flexBasis == 0.f);
 
         state.getChild(0).setProperty("flex-basis", 4.f, nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.flexBasis == 4.f);
     }
@@ -245,14 +234,14 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.alignSelf == juce::FlexItem{}.alignSelf);
 
         state.getChild(0).setProperty("align-self", "centre", nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.alignSelf == juce::FlexItem::AlignSelf::center);
     }
@@ -276,7 +265,7 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
         expectEquals(flexItem.width, juce::FlexItem{}.width);
         expectEquals(flexItem.height, juce::FlexItem{}.height);
 
@@ -284,7 +273,7 @@ private:
         state.getChild(0).setProperty("height", 175.f, nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.width == 50.f);
         expect(flexItem.height == 175.f);
@@ -309,7 +298,7 @@ private:
         auto& item = *parent->getChildren()[0];
         auto flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                             .toType<jive::FlexItem>()
-                            ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                            ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.margin.top == 0.f);
         expect(flexItem.margin.right == 0.f);
@@ -319,7 +308,7 @@ private:
         state.getChild(0).setProperty("margin", "1 2 3 4", nullptr);
         flexItem = dynamic_cast<jive::GuiItemDecorator&>(item)
                        .toType<jive::FlexItem>()
-                       ->toJuceFlexItem({}, jive::LayoutStrategy::real);
+                       ->toJuceFlexItem({}, jive::Orientation::vertical, jive::LayoutStrategy::real);
 
         expect(flexItem.margin.top == 1.f);
         expect(flexItem.margin.right == 2.f);
@@ -8,6 +8,7 @@ namespace jive
         explicit FlexItem(std::unique_ptr<GuiItem> itemToDecorate);
 
         [[nodiscard]] juce::FlexItem toJuceFlexItem(juce::Rectangle<float> parentContentBounds,
+                                                    Orientation parentOrientation,
                                                     LayoutStrategy strategy) const;
 
     private:
@@ -4,38 +4,30 @@ namespace jive
 {
     GridContainer::GridContainer(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem(std::move(itemToDecorate))
-        , justifyItems{ state, "justify-items" }
-        , alignItems{ state, "align-items" }
-        , justifyContent{ state, "justify-content" }
-        , alignContent{ state, "align-content" }
-        , gridAutoFlow{ state, "grid-auto-flow" }
-        , gridTemplateColumns{ state, "grid-template-columns" }
-        , gridTemplateRows{ state, "grid-template-rows" }
-        , gridTemplateAreas{ state, "grid-template-areas" }
-        , gridAutoRows{ state, "grid-auto-rows" }
-        , gridAutoColumns{ state, "grid-auto-columns" }
-        , gap{ state, "gap" }
+        , justifyItems{ state, ids::justifyItems() }
+        , alignItems{ state, ids::alignItems() }
+        , justifyContent{ state, ids::justifyContent() }
+        , alignContent{ state, ids::alignContent() }
+        , gridAutoFlow{ state, ids::gridAutoFlow() }
+        , gridTemplateColumns{ state, ids::gridTemplateColumns() }
+        , gridTemplateRows{ state, ids::gridTemplateRows() }
+        , gridTemplateAreas{ state, ids::gridTemplateAreas() }
+        , gridAutoRows{ state, ids::gridAutoRows() }
+        , gridAutoColumns{ state, ids::gridAutoColumns() }
+        , gap{ state, ids::gap() }
         , boxModel{ toType<CommonGuiItem>()->boxModel }
     {
-        jassert(state.hasProperty("display"));
-        jassert(state["display"] == juce::VariantConverter<Display>::toVar(Display::grid));
+        jassert(Property<Display>(state, ids::display()).get() == Display::grid);
 
         static const juce::Grid defaultGrid;
 
-        if (!justifyItems.exists())
-            justifyItems = defaultGrid.justifyItems;
-        if (!alignItems.exists())
-            alignItems = defaultGrid.alignItems;
-        if (!justifyContent.exists())
-            justifyContent = defaultGrid.justifyContent;
-        if (!alignContent.exists())
-            alignContent = defaultGrid.alignContent;
-        if (!gridAutoFlow.exists())
-            gridAutoFlow = defaultGrid.autoFlow;
-        if (!gridAutoRows.exists())
-            gridAutoRows = defaultGrid.autoRows;
-        if (!gridAutoColumns.exists())
-            gridAutoColumns = defaultGrid.autoColumns;
+        justifyItems.setDefault(defaultGrid.justifyItems);
+        alignItems.setDefault(defaultGrid.alignItems);
+        justifyContent.setDefault(defaultGrid.justifyContent);
+        alignContent.setDefault(defaultGrid.alignContent);
+        gridAutoFlow.setDefault(defaultGrid.autoFlow);
+        gridAutoRows.setDefault(defaultGrid.autoRows);
+        gridAutoColumns.setDefault(defaultGrid.autoColumns);
 
         justifyItems.onValueChange = [this]() {
             layoutChanged();
@@ -78,6 +70,7 @@ namespace jive
             return;
 
         const juce::ScopedValueSetter svs{ layoutRecursionLock, true };
+        JIVE_INSTRUMENT_PHASE(layout);
 
         GuiItemDecorator::layOutChildren();
 
@@ -87,6 +80,8 @@ namespace jive
             return;
         do
         {
+            JIVE_INSTRUMENT_PHASE(layoutPass);
+
             changesDuringLayout = false;
             buildGrid(bounds, LayoutStrategy::real)
                 .performLayout(bounds);
@@ -100,8 +95,28 @@ namespace jive
                          LayoutStrategy::real);
     }
 
+    const juce::Array<juce::Identifier>& GridContainer::getLayoutPropertyIDs() const
+    {
+        static const juce::Array<juce::Identifier> layoutPropertyIDs{
+            ids::justifyItems(),
+            ids::alignItems(),
+            ids::justifyContent(),
+            ids::alignContent(),
+            ids::gridAutoFlow(),
+            ids::gridTemplateColumns(),
+            ids::gridTemplateRows(),
+            ids::gridTemplateAreas(),
+            ids::gridAutoRows(),
+            ids::gridAutoColumns(),
+            ids::gap(),
+        };
+        return layoutPropertyIDs;
+    }
+
     juce::Rectangle<float> GridContainer::calculateIdealSize(juce::Rectangle<float> constraints) const
     {
+        JIVE_INSTRUMENT_PHASE(idealSizeCalculation);
+
         auto integerConstraints = constraints.toNearestInt().withZeroOrigin();
         integerConstraints.setHeight(static_cast<int>(std::numeric_limits<juce::uint16>::max()));
 
@@ -13,6 +13,7 @@ namespace jive
 
     protected:
         juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const override;
+        const juce::Array<juce::Identifier>& getLayoutPropertyIDs() const override;
 
     private:
         juce::Grid buildGrid(juce::Rectangle<int> bounds,
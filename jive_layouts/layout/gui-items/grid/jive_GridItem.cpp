@@ -4,28 +4,24 @@ namespace jive
 {
     GridItem::GridItem(std::unique_ptr<GuiItem> itemToDecorate)
         : ContainerItem::Child{ std::move(itemToDecorate) }
-        , order{ state, "order" }
-        , justifySelf{ state, "justify-self" }
-        , alignSelf{ state, "align-self" }
-        , gridColumn{ state, "grid-column" }
-        , gridRow{ state, "grid-row" }
-        , gridArea{ state, "grid-area" }
+        , order{ state, ids::order() }
+        , justifySelf{ state, ids::justifySelf() }
+        , alignSelf{ state, ids::alignSelf() }
+        , gridColumn{ state, ids::gridColumn() }
+        , gridRow{ state, ids::gridRow() }
+        , gridArea{ state, ids::gridArea() }
     {
         static const juce::GridItem defaultGridItem;
 
-        if (!justifySelf.exists())
-            justifySelf = defaultGridItem.justifySelf;
-        if (!alignSelf.exists())
-            alignSelf = defaultGridItem.alignSelf;
-        if (!gridColumn.exists())
-            gridColumn = defaultGridItem.column;
-        if (!gridRow.exists())
-            gridRow = defaultGridItem.row;
-        if (!gridArea.exists())
-            gridArea = defaultGridItem.area;
+        justifySelf.setDefault(defaultGridItem.justifySelf);
+        alignSelf.setDefault(defaultGridItem.alignSelf);
+        gridColumn.setDefault(defaultGridItem.column);
+        gridRow.setDefault(defaultGridItem.row);
+        gridArea.setDefault(defaultGridItem.area);
 
         const auto invalidateParentBoxModel = [this]() {
-            getParent()->state.setProperty("box-model-valid", false, nullptr);
+            boxModel(*this).intrinsicSizeChanged();
+            boxModel(*getParent()).invalidate();
         };
         order.onValueChange = invalidateParentBoxModel;
         justifySelf.onValueChange = invalidateParentBoxModel;
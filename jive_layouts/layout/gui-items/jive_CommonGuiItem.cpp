@@ -5,43 +5,35 @@ namespace jive
     CommonGuiItem::CommonGuiItem(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
         , boxModel{ state }
-        , name{ state, "name" }
-        , title{ state, "title" }
-        , id{ state, "id" }
-        , description{ state, "description" }
-        , tooltip{ state, "tooltip" }
-        , enabled{ state, "enabled" }
-        , accessible{ state, "accessible" }
-        , visibility{ state, "visibility" }
-        , alwaysOnTop{ state, "always-on-top" }
-        , bufferedToImage{ state, "buffered-to-image" }
-        , opaque{ state, "opaque" }
-        , focusable{ state, "focusable" }
-        , clickingGrabsFocus{ state, "clicking-grabs-focus" }
-        , focusOutline{ state, "focus-outline" }
-        , focusOrder{ state, "focus-order" }
-        , opacity{ state, "opacity" }
-        , cursor{ state, "cursor" }
-        , display{ state, "display" }
-        , width{ state, "width" }
-        , height{ state, "height" }
+        , name{ state, ids::name() }
+        , title{ state, ids::title() }
+        , id{ state, ids::id() }
+        , description{ state, ids::description() }
+        , tooltip{ state, ids::tooltip() }
+        , enabled{ state, ids::enabled() }
+        , accessible{ state, ids::accessible() }
+        , visibility{ state, ids::visibility() }
+        , alwaysOnTop{ state, ids::alwaysOnTop() }
+        , bufferedToImage{ state, ids::bufferedToImage() }
+        , opaque{ state, ids::opaque() }
+        , focusable{ state, ids::focusable() }
+        , clickingGrabsFocus{ state, ids::clickingGrabsFocus() }
+        , focusOutline{ state, ids::focusOutline() }
+        , focusOrder{ state, ids::focusOrder() }
+        , opacity{ state, ids::opacity() }
+        , cursor{ state, ids::cursor() }
+        , display{ state, ids::display() }
+        , width{ state, ids::width() }
+        , height{ state, ids::height() }
     {
-        if (!enabled.exists())
-            enabled = true;
-        if (!accessible.exists())
-            accessible = true;
-        if (!visibility.exists())
-            visibility = true;
-        if (!clickingGrabsFocus.exists())
-            clickingGrabsFocus = true;
-        if (!focusOrder.exists())
-            focusOrder = state.getParent().indexOf(state) + 1;
-        if (!opacity.exists())
-            opacity = 1.0f;
-        if (!cursor.exists())
-            cursor = juce::MouseCursor::NormalCursor;
-        if (!display.exists())
-            display = Display::flex;
+        enabled.setDefault(true);
+        accessible.setDefault(true);
+        visibility.setDefault(true);
+        clickingGrabsFocus.setDefault(true);
+        focusOrder.setDefault(state.getParent().indexOf(state) + 1);
+        opacity.setDefault(1.0f);
+        cursor.setDefault(juce::MouseCursor::NormalCursor);
+        display.setDefault(Display::flex);
 
         component->addComponentListener(this);
 
@@ -254,12 +246,12 @@ namespace jive
 
         component->setSize(juce::roundToInt(boxModel.getWidth()),
                            juce::roundToInt(boxModel.getHeight()));
-        getTopLevelDecorator().layOutChildren();
+        LayoutScheduler::requestLayout(getTopLevelDecorator());
     }
 
     void CommonGuiItem::childrenChanged()
     {
-        getTopLevelDecorator().layOutChildren();
+        LayoutScheduler::requestLayout(getTopLevelDecorator());
     }
 } // namespace jive
 
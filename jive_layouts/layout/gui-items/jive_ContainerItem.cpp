@@ -4,8 +4,6 @@ namespace jive
 {
     ContainerItem::ContainerItem(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , idealWidth{ state, "ideal-width" }
-        , idealHeight{ state, "ideal-height" }
         , boxModel{ toType<CommonGuiItem>()->boxModel }
     {
         boxModel.addListener(*this);
@@ -36,29 +34,147 @@ namespace jive
             layoutChanged();
     }
 
+    std::optional<float> ContainerItem::measureHeightForWidth(float width) const
+    {
+        // Measuring a child at the width its parent is about to give it,
+        // rather than the width it had, saves its parent a layout pass when
+        // the child's height depends on its width.
+        const auto insets = boxModel.getPadding().getLeftAndRight() + boxModel.getBorder().getLeftAndRight();
+        const auto constraints = boxModel.getContentBounds().withWidth(juce::jmax(0.0f, width - insets));
+
+        return const_cast<ContainerItem*>(this)->measureIdealSize(constraints).getHeight();
+    }
+
     void ContainerItem::boxModelInvalidated(BoxModel& box)
     {
-        const auto newIdealSize = calculateIdealSize(box.getContentBounds());
-        const auto idealWidthChanged = !juce::approximatelyEqual(newIdealSize.getWidth(), idealWidth.get());
-        const auto idealHeightChanged = !juce::approximatelyEqual(newIdealSize.getHeight(), idealHeight.get());
+        const auto newIdealSize = measureIdealSize(box.getContentBounds());
+        const auto idealWidthChanged = !juce::approximatelyEqual(newIdealSize.getWidth(), box.getIdealWidth().value_or(0.0f));
+        const auto idealHeightChanged = !juce::approximatelyEqual(newIdealSize.getHeight(), box.getIdealHeight().value_or(0.0f));
 
-        idealWidth = newIdealSize.getWidth();
-        idealHeight = newIdealSize.getHeight();
+        box.setIdealWidth(newIdealSize.getWidth());
+        box.setIdealHeight(newIdealSize.getHeight());
 
         const auto idealSizeChanged = idealWidthChanged || idealHeightChanged;
 
         if (!idealSizeChanged || isTopLevel())
-            layOutChildren();
+            LayoutScheduler::requestLayout(getTopLevelDecorator());
+    }
+
+    const juce::Array<juce::Identifier>& ContainerItem::getLayoutPropertyIDs() const
+    {
+        static const juce::Array<juce::Identifier> none;
+        return none;
     }
 
     void ContainerItem::layoutChanged()
     {
-        const auto newIdealSize = calculateIdealSize({
+        measurements.clear();
+
+        const auto newIdealSize = measureIdealSize({
             static_cast<float>(std::numeric_limits<juce::uint16>::max()),
             static_cast<float>(std::numeric_limits<juce::uint16>::max()),
         });
-        idealWidth = newIdealSize.getWidth();
-        idealHeight = newIdealSize.getHeight();
+        boxModel.setIdealWidth(newIdealSize.getWidth());
+        boxModel.setIdealHeight(newIdealSize.getHeight());
+    }
+
+    juce::Rectangle<float> ContainerItem::measureIdealSize(juce::Rectangle<float> constraints)
+    {
+        // Laying out a container resizes each of its children in turn, each
+        // of which asks for the container to be measured again with exactly
+        // the same inputs, so previous measurements are reused until
+        // something that could change them does.
+        if (haveMeasurementInputsChanged())
+            measurements.clear();
+
+        for (const auto& measurement : measurements)
+        {
+            if (measurement.constraints == constraints)
+                return measurement.idealSize;
+        }
+
+        const auto idealSize = calculateIdealSize(constraints);
+
+        if (measurements.size() >= maxNumCachedMeasurements)
+            measurements.erase(std::begin(measurements));
+
+        measurements.push_back({ constraints, idealSize });
+        return idealSize;
+    }
+
+    bool ContainerItem::haveMeasurementInputsChanged()
+    {
+        auto changed = false;
+
+        // Children's sizes can be relative to this item's size, and this
+        // item's padding and border are added to its ideal size.
+        if (const auto bounds = boxModel.getOuterBounds(), contentBounds = boxModel.getContentBounds();
+            bounds != measuredBounds || contentBounds != measuredContentBounds)
+        {
+            measuredBounds = bounds;
+            measuredContentBounds = contentBounds;
+            changed = true;
+        }
+
+        // The content bounds don't reflect a change of padding or border
+        // while the item has no size yet, and the container's own layout
+        // properties may have changed before it's been told about them.
+        if (haveLayoutPropertiesChanged())
+            changed = true;
+
+        const auto children = getChildren();
+
+        if (measuredVersions.size() != static_cast<std::size_t>(children.size()))
+        {
+            measuredVersions.resize(static_cast<std::size_t>(children.size()));
+            changed = true;
+        }
+
+        for (auto i = 0; i < children.size(); i++)
+        {
+            const auto version = jive::boxModel(*children[i]).getIntrinsicSizeVersion();
+            auto& measuredVersion = measuredVersions[static_cast<std::size_t>(i)];
+
+            if (measuredVersion != version)
+            {
+                measuredVersion = version;
+                changed = true;
+            }
+        }
+
+        return changed;
+    }
+
+    bool ContainerItem::haveLayoutPropertiesChanged()
+    {
+        const auto& layoutPropertyIDs = getLayoutPropertyIDs();
+        const auto numProperties = static_cast<std::size_t>(2 + layoutPropertyIDs.size());
+        auto changed = false;
+
+        if (measuredLayoutProperties.size() != numProperties)
+        {
+            measuredLayoutProperties.resize(numProperties);
+            changed = true;
+        }
+
+        const auto check = [this, &changed](std::size_t index, const juce::Identifier& id) {
+            const auto& value = state[id];
+            auto& measuredValue = measuredLayoutProperties[index];
+
+            if (!measuredValue.equalsWithSameType(value))
+            {
+                measuredValue = value;
+                changed = true;
+            }
+        };
+
+        check(0, ids::padding());
+        check(1, ids::borderWidth());
+
+        for (auto i = 0; i < layoutPropertyIDs.size(); i++)
+            check(static_cast<std::size_t>(2 + i), layoutPropertyIDs.getReference(i));
+
+        return changed;
     }
 } // namespace jive
 
@@ -74,6 +190,8 @@ public:
     void runTest() final
     {
         testIdealSizeCalculation();
+        testMeasurementCache();
+        testMeasuringAfterLayoutPropertiesChange();
     }
 
 private:
@@ -107,9 +225,108 @@ private:
         };
         auto commonItem = std::make_unique<jive::CommonGuiItem>(std::make_unique<jive::GuiItem>(std::make_unique<juce::Component>(), state));
         SpyContainer container{ std::move(commonItem) };
-        state.setProperty("box-model-valid", false, nullptr);
+        jive::boxModel(container).invalidate();
         expectEquals(container.givenConstraints, jive::boxModel(container).getContentBounds());
     }
+
+    void testMeasurementCache()
+    {
+        beginTest("measurement cache");
+
+        class CountingContainer : public jive::ContainerItem
+        {
+        public:
+            using jive::ContainerItem::ContainerItem;
+
+            mutable int numCalculations = 0;
+
+        protected:
+            juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const final
+            {
+                numCalculations++;
+                return constraints;
+            }
+        };
+
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 300 },
+                { "height", 200 },
+            },
+        };
+        auto commonItem = std::make_unique<jive::CommonGuiItem>(std::make_unique<jive::GuiItem>(std::make_unique<juce::Component>(), state));
+        CountingContainer container{ std::move(commonItem) };
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, 1);
+
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, 1);
+
+        state.setProperty("padding", 10, nullptr);
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, 2);
+    }
+
+    void testMeasuringAfterLayoutPropertiesChange()
+    {
+        beginTest("measuring after layout properties change");
+
+        class CountingContainer : public jive::ContainerItem
+        {
+        public:
+            using jive::ContainerItem::ContainerItem;
+
+            mutable int numCalculations = 0;
+
+        protected:
+            juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const final
+            {
+                numCalculations++;
+                return constraints;
+            }
+
+            const juce::Array<juce::Identifier>& getLayoutPropertyIDs() const final
+            {
+                static const juce::Array<juce::Identifier> layoutPropertyIDs{ "gap" };
+                return layoutPropertyIDs;
+            }
+        };
+
+        // With no size, the container's content bounds stay empty whatever
+        // its padding and border, so only the properties themselves show the
+        // change.
+        juce::ValueTree state{
+            "Component",
+            {
+                { "width", 0 },
+                { "height", 0 },
+            },
+        };
+        auto commonItem = std::make_unique<jive::CommonGuiItem>(std::make_unique<jive::GuiItem>(std::make_unique<juce::Component>(), state));
+        CountingContainer container{ std::move(commonItem) };
+        jive::boxModel(container).invalidate();
+        const auto numCalculations = container.numCalculations;
+
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, numCalculations);
+
+        state.setProperty("padding", 10, nullptr);
+        jive::boxModel(container).invalidate();
+        expect(jive::boxModel(container).getContentBounds().isEmpty());
+        expectEquals(container.numCalculations, numCalculations + 1);
+
+        state.setProperty("border-width", 2, nullptr);
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, numCalculations + 2);
+
+        state.setProperty("gap", 5, nullptr);
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, numCalculations + 3);
+
+        jive::boxModel(container).invalidate();
+        expectEquals(container.numCalculations, numCalculations + 3);
+    }
 };
 
 static ContainerItemUnitTest containerItemUnitTest;
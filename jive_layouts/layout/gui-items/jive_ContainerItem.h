@@ -31,17 +31,45 @@ namespace jive
         void insertChild(std::unique_ptr<GuiItem> child, int index) override;
         void setChildren(std::vector<std::unique_ptr<GuiItem>>&& newChildren) override;
 
+        /** Returns the height the container needs to fit its children when
+            it's the given width, including its padding and border.
+        */
+        std::optional<float> measureHeightForWidth(float width) const override;
+
     protected:
         void boxModelInvalidated(BoxModel& boxModel) override;
 
         virtual juce::Rectangle<float> calculateIdealSize(juce::Rectangle<float> constraints) const = 0;
 
+        /** Returns the IDs of the container's own properties, other than its
+            size, padding and border, that its ideal size depends on.
+
+            Measurements are only reused for as long as none of these
+            properties has changed.
+        */
+        [[nodiscard]] virtual const juce::Array<juce::Identifier>& getLayoutPropertyIDs() const;
+
         void layoutChanged();
 
     private:
-        Property<float> idealWidth;
-        Property<float> idealHeight;
+        struct Measurement
+        {
+            juce::Rectangle<float> constraints;
+            juce::Rectangle<float> idealSize;
+        };
+
+        static constexpr auto maxNumCachedMeasurements = 4;
+
+        [[nodiscard]] juce::Rectangle<float> measureIdealSize(juce::Rectangle<float> constraints);
+        [[nodiscard]] bool haveMeasurementInputsChanged();
+        [[nodiscard]] bool haveLayoutPropertiesChanged();
 
         BoxModel& boxModel;
+
+        std::vector<Measurement> measurements;
+        std::vector<juce::uint32> measuredVersions;
+        juce::Rectangle<float> measuredBounds;
+        juce::Rectangle<float> measuredContentBounds;
+        std::vector<juce::var> measuredLayoutProperties;
     };
 } // namespace jive
@@ -6,12 +6,11 @@ namespace jive
     {
     public:
         explicit Pimpl(jive::GuiItemDecorator& item)
-            : state{ item.state }
-            , order{ state, "order" }
-            , width{ state, "width" }
-            , height{ state, "height" }
-            , idealWidth{ state, "ideal-width" }
-            , idealHeight{ state, "ideal-height" }
+            : decorator{ item }
+            , state{ item.state }
+            , order{ state, ids::order() }
+            , width{ state, ids::width() }
+            , height{ state, ids::height() }
             , boxModel{ item.toType<CommonGuiItem>()->boxModel }
         {
         }
@@ -61,10 +60,10 @@ namespace jive
             {
                 item.width = width.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
             }
-            else if (idealWidth.exists())
+            else if (const auto idealWidth = boxModel.getIdealWidth())
             {
-                if (idealWidth.get() < parentContentBounds.getWidth() || strategy == LayoutStrategy::dummy)
-                    item.minWidth = juce::jmax(item.minWidth, idealWidth.get());
+                if (*idealWidth < parentContentBounds.getWidth() || strategy == LayoutStrategy::dummy)
+                    item.minWidth = juce::jmax(item.minWidth, *idealWidth);
                 else
                     item.width = parentContentBounds.getWidth();
             }
@@ -73,26 +72,13 @@ namespace jive
             {
                 item.height = height.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
             }
-            else if (idealHeight.exists())
+            else if (const auto measuredHeight = measureHeight(item, parentContentBounds, strategy))
             {
-                const auto property = state["ideal-height"];
-
-                if (const auto calculateHeight = property.getNativeFunction();
-                    calculateHeight != nullptr)
-                {
-                    juce::var args[] = {
-                        strategy == LayoutStrategy::dummy
-                            ? juce::jmin(idealWidth.get(), parentContentBounds.getWidth())
-                            : juce::jmax(item.width, item.minWidth),
-                    };
-                    item.minHeight = juce::jmax(item.minHeight,
-                                                static_cast<float>(calculateHeight({ property, args, 1 })));
-                }
-                else
-                {
-                    item.minHeight = juce::jmax(item.minHeight,
-                                                static_cast<float>(property));
-                }
+                item.minHeight = juce::jmax(item.minHeight, *measuredHeight);
+            }
+            else if (const auto idealHeight = boxModel.getIdealHeight())
+            {
+                item.minHeight = juce::jmax(item.minHeight, *idealHeight);
             }
         }
 
@@ -103,40 +89,40 @@ namespace jive
         {
             if (!width.isAuto())
                 item.width = width.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
-            else if (idealWidth.exists())
-                item.width = idealWidth.get();
+            else if (const auto idealWidth = boxModel.getIdealWidth())
+                item.width = *idealWidth;
 
             if (!height.isAuto())
             {
                 item.height = height.toPixels(strategy == LayoutStrategy::real ? parentContentBounds : juce::Rectangle<float>{});
             }
-            else if (idealHeight.exists())
+            else if (const auto measuredHeight = measureHeight(item, parentContentBounds, strategy))
             {
-                const auto property = state["ideal-height"];
-
-                if (const auto calculateHeight = property.getNativeFunction();
-                    calculateHeight != nullptr)
-                {
-                    juce::var args[] = {
-                        strategy == LayoutStrategy::dummy
-                            ? juce::jmin(idealWidth.get(), parentContentBounds.getWidth())
-                            : juce::jmax(item.width, item.minWidth),
-                    };
-                    const auto idealHeightAbsolute = static_cast<float>(calculateHeight({ property, args, 1 }));
-
-                    if (idealHeightAbsolute < parentContentBounds.getHeight() || strategy == LayoutStrategy::dummy)
-                        item.minHeight = juce::jmax(item.minHeight, idealHeightAbsolute);
-                    else
-                        item.height = parentContentBounds.getHeight();
-                }
+                if (*measuredHeight < parentContentBounds.getHeight() || strategy == LayoutStrategy::dummy)
+                    item.minHeight = juce::jmax(item.minHeight, *measuredHeight);
                 else
-                {
-                    item.minHeight = juce::jmax(item.minHeight,
-                                                static_cast<float>(property));
-                }
+                    item.height = parentContentBounds.getHeight();
+            }
+            else if (const auto idealHeight = boxModel.getIdealHeight())
+            {
+                item.minHeight = juce::jmax(item.minHeight, *idealHeight);
             }
         }
 
+        // Content whose height depends on its width (i.e. text) is measured
+        // directly at the width it's being given, rather than through the
+        // tree.
+        template <typename FlexOrGridItem>
+        [[nodiscard]] std::optional<float> measureHeight(const FlexOrGridItem& item,
+                                                         juce::Rectangle<float> parentContentBounds,
+                                                         LayoutStrategy strategy) const
+        {
+            const auto availableWidth = strategy == LayoutStrategy::dummy
+                                          ? juce::jmin(boxModel.getIdealWidth().value_or(0.0f), parentContentBounds.getWidth())
+                                          : juce::jmax(item.width, item.minWidth);
+            return decorator.getTopLevelDecorator().measureHeightForWidth(availableWidth);
+        }
+
         template <typename FlexOrGridItem>
         [[nodiscard]] auto getMargin() const
         {
@@ -151,12 +137,11 @@ namespace jive
             };
         }
 
+        const GuiItemDecorator& decorator;
         const juce::ValueTree state;
         const Property<int> order;
         const Length width;
         const Length height;
-        const Property<float> idealWidth;
-        const Property<float> idealHeight;
         const BoxModel& boxModel;
     };
 
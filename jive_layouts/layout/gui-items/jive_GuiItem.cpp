@@ -15,6 +15,7 @@ namespace jive
         , styleSheet{ sheet }
 #endif
         , remover{ std::make_unique<Remover>(*this) }
+        , deferredLayout{ *this }
     {
         jassert(component != nullptr);
     }
@@ -50,6 +51,11 @@ namespace jive
     {
     }
 
+    GuiItem::~GuiItem()
+    {
+        LayoutScheduler::cancel(*this);
+    }
+
     const std::shared_ptr<const juce::Component> GuiItem::getComponent() const
     {
         return component;
@@ -131,6 +137,11 @@ namespace jive
         return false;
     }
 
+    std::optional<float> GuiItem::measureHeightForWidth(float) const
+    {
+        return std::nullopt;
+    }
+
     GuiItem::Remover::Remover(GuiItem& guiItem)
         : item{ guiItem }
         , parent{ item.getParent() }
@@ -153,6 +164,21 @@ namespace jive
             parent->removeChild(item);
     }
 
+    GuiItem::DeferredLayout::DeferredLayout(GuiItem& guiItem)
+        : item{ guiItem }
+    {
+    }
+
+    const juce::ValueTree& GuiItem::DeferredLayout::getTreeToBatch() const
+    {
+        return item.state;
+    }
+
+    void GuiItem::DeferredLayout::invokeDeferredCallback()
+    {
+        item.layOutChildren();
+    }
+
     BoxModel& boxModel(GuiItem& item)
     {
         // This is a convenience function that only works if the given GUI item
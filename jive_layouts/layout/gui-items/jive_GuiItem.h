@@ -13,7 +13,7 @@ namespace jive
                 GuiItem* parent = nullptr);
 
         GuiItem(const GuiItem& other);
-        virtual ~GuiItem() = default;
+        virtual ~GuiItem();
 
         const std::shared_ptr<const juce::Component> getComponent() const;
         const std::shared_ptr<juce::Component> getComponent();
@@ -30,6 +30,12 @@ namespace jive
         virtual bool isContainer() const;
         virtual bool isContent() const;
 
+        /** Returns the height the item's content needs in order to fit within
+            the given width, or std::nullopt if the item has no content whose
+            height depends on its width.
+        */
+        virtual std::optional<float> measureHeightForWidth(float width) const;
+
         virtual void layOutChildren() {}
 
         juce::ValueTree state;
@@ -42,6 +48,19 @@ namespace jive
 
     private:
         friend class GuiItemDecorator;
+        friend class LayoutScheduler;
+
+        class DeferredLayout : public PropertyTransaction::Callback
+        {
+        public:
+            explicit DeferredLayout(GuiItem& guiItem);
+
+            [[nodiscard]] const juce::ValueTree& getTreeToBatch() const final;
+            void invokeDeferredCallback() final;
+
+        private:
+            GuiItem& item;
+        };
 
         class Remover : private juce::ValueTree::Listener
         {
@@ -72,6 +91,7 @@ namespace jive
         void insertChild(std::unique_ptr<GuiItem> child, int index, bool invokeCallback);
 
         std::unique_ptr<Remover> remover;
+        DeferredLayout deferredLayout;
 
         JUCE_LEAK_DETECTOR(GuiItem)
     };
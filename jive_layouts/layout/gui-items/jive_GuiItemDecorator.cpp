@@ -52,6 +52,11 @@ namespace jive
         return item->isContent();
     }
 
+    std::optional<float> GuiItemDecorator::measureHeightForWidth(float width) const
+    {
+        return item->measureHeightForWidth(width);
+    }
+
     GuiItem* GuiItemDecorator::getParent()
     {
         if (auto* parentItem = item->getParent())
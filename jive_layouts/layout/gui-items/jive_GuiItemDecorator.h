@@ -17,6 +17,7 @@ namespace jive
 
         bool isContainer() const override;
         bool isContent() const override;
+        std::optional<float> measureHeightForWidth(float width) const override;
 
         GuiItemDecorator& getTopLevelDecorator();
         const GuiItemDecorator& getTopLevelDecorator() const;
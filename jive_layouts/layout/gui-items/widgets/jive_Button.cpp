@@ -16,33 +16,28 @@ namespace jive
 
     Button::Button(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , toggleable{ state, "toggleable" }
-        , toggled{ state, "toggled" }
-        , toggleOnClick{ state, "toggle-on-click" }
-        , radioGroup{ state, "radio-group" }
-        , triggerEvent{ state, "trigger-event" }
-        , tooltip{ state, "tooltip" }
-        , text{ state, "text" }
-        , flexDirection{ state, "flex-direction" }
-        , justifyContent{ state, "justify-content" }
-        , padding{ state, "padding" }
-        , minWidth{ state, "min-width" }
-        , minHeight{ state, "min-height" }
-        , focusable{ state, "focusable" }
-        , onClick{ state, "on-click" }
+        , toggleable{ state, ids::toggleable() }
+        , toggled{ state, ids::toggled() }
+        , toggleOnClick{ state, ids::toggleOnClick() }
+        , radioGroup{ state, ids::radioGroup() }
+        , triggerEvent{ state, ids::triggerEvent() }
+        , tooltip{ state, ids::tooltip() }
+        , text{ state, ids::text() }
+        , flexDirection{ state, ids::flexDirection() }
+        , justifyContent{ state, ids::justifyContent() }
+        , padding{ state, ids::padding() }
+        , minWidth{ state, ids::minWidth() }
+        , minHeight{ state, ids::minHeight() }
+        , focusable{ state, ids::focusable() }
+        , onClick{ state, ids::onClick() }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
-        if (!triggerEvent.exists())
-            triggerEvent = TriggerEvent::mouseUp;
-        if (!padding.exists())
-            padding = juce::BorderSize{ 0.0f, 5.0f, 0.0f, 5.0f };
-        if (!minWidth.exists())
-            minWidth = 50.0f;
-        if (!minHeight.exists())
-            minHeight = 20.0f;
-        if (!focusable.exists())
-            focusable = true;
+        triggerEvent.setDefault(TriggerEvent::mouseUp);
+        padding.setDefault(juce::BorderSize{ 0.0f, 5.0f, 0.0f, 5.0f });
+        minWidth.setDefault(50.0f);
+        minHeight.setDefault(20.0f);
+        focusable.setDefault(true);
 
         toggleable.onValueChange = [this]() {
             getButton().setToggleable(toggleable);
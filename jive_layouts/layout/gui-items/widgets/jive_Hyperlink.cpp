@@ -4,7 +4,7 @@ namespace jive
 {
     Hyperlink::Hyperlink(std::unique_ptr<GuiItem> itemToDecorate)
         : Button(std::move(itemToDecorate))
-        , url{ state, "url" }
+        , url{ state, ids::url() }
     {
         url.onValueChange = [this]() {
             getHyperlink().setURL(url);
@@ -14,7 +14,7 @@ namespace jive
 
     Label::Label(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , border{ state, "border-width" }
+        , border{ state, ids::borderWidth() }
     {
         border.onValueChange = [this]() {
             getLabel().setBorderSize(toNearestInt(border));
@@ -9,37 +9,31 @@ namespace jive
 
     Slider::Slider(std::unique_ptr<GuiItem> itemToDecorate, float defaultWidth, float defaultHeight)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , value{ state, "value" }
-        , min{ state, "min" }
-        , max{ state, "max" }
-        , mid{ state, "mid" }
-        , interval{ state, "interval" }
-        , orientation{ state, "orientation" }
-        , width{ state, "width" }
-        , height{ state, "height" }
-        , sensitivity{ state, "sensitivity" }
-        , isInVelocityMode{ state, "velocity-mode" }
-        , velocitySensitivity{ state, "velocity-sensitivity" }
-        , velocityThreshold{ state, "velocity-threshold" }
-        , velocityOffset{ state, "velocity-offset" }
-        , snapToMouse{ state, "snap-to-mouse" }
-        , focusable{ state, "focusable" }
-        , onChange{ state, "on-change" }
+        , value{ state, ids::value() }
+        , min{ state, ids::min() }
+        , max{ state, ids::max() }
+        , mid{ state, ids::mid() }
+        , interval{ state, ids::interval() }
+        , orientation{ state, ids::orientation() }
+        , width{ state, ids::width() }
+        , height{ state, ids::height() }
+        , sensitivity{ state, ids::sensitivity() }
+        , isInVelocityMode{ state, ids::velocityMode() }
+        , velocitySensitivity{ state, ids::velocitySensitivity() }
+        , velocityThreshold{ state, ids::velocityThreshold() }
+        , velocityOffset{ state, ids::velocityOffset() }
+        , snapToMouse{ state, ids::snapToMouse() }
+        , focusable{ state, ids::focusable() }
+        , onChange{ state, ids::onChange() }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
-        if (!max.exists())
-            max = "1.0";
-        if (!sensitivity.exists())
-            sensitivity = 1.0;
-        if (!velocitySensitivity.exists())
-            velocitySensitivity = 1.0;
-        if (!velocityThreshold.exists())
-            velocityThreshold = 1;
-        if (!snapToMouse.exists())
-            snapToMouse = true;
-        if (!focusable.exists())
-            focusable = true;
+        max.setDefault("1.0");
+        sensitivity.setDefault(1.0);
+        velocitySensitivity.setDefault(1.0);
+        velocityThreshold.setDefault(1);
+        snapToMouse.setDefault(true);
+        focusable.setDefault(true);
 
         min.onValueChange = [this]() {
             updateRange();
@@ -4,7 +4,7 @@ namespace jive
 {
     Spinner::Spinner(std::unique_ptr<GuiItem> itemToDecorate)
         : Slider{ std::move(itemToDecorate), 70.0f, 20.0f }
-        , draggable{ state, "draggable" }
+        , draggable{ state, ids::draggable() }
     {
         draggable.onValueChange = [this]() {
             getSlider().setIncDecButtonsMode(draggable ? juce::Slider::incDecButtonsDraggable_AutoDirection : juce::Slider::incDecButtonsNotDraggable);
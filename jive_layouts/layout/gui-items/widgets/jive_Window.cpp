@@ -8,52 +8,41 @@ namespace jive
 {
     Window::Window(std::unique_ptr<GuiItem> itemToDecorate)
         : GuiItemDecorator{ std::move(itemToDecorate) }
-        , hasShadow{ state, "shadow" }
-        , isNative{ state, "native" }
-        , isResizable{ state, "resizable" }
-        , useCornerResizer{ state, "corner-resizer" }
-        , minWidth{ state, "min-width" }
-        , minHeight{ state, "min-height" }
-        , maxWidth{ state, "max-width" }
-        , maxHeight{ state, "max-height" }
-        , isDraggable{ state, "draggable" }
-        , isFullScreen{ state, "full-screen" }
-        , isMinimised{ state, "minimised" }
-        , name{ state, "name" }
-        , titleBarHeight{ state, "title-bar-height" }
-        , titleBarButtons{ state, "title-bar-buttons" }
-        , width{ state, "width" }
-        , height{ state, "height" }
+        , hasShadow{ state, ids::shadow() }
+        , isNative{ state, ids::native() }
+        , isResizable{ state, ids::resizable() }
+        , useCornerResizer{ state, ids::cornerResizer() }
+        , minWidth{ state, ids::minWidth() }
+        , minHeight{ state, ids::minHeight() }
+        , maxWidth{ state, ids::maxWidth() }
+        , maxHeight{ state, ids::maxHeight() }
+        , isDraggable{ state, ids::draggable() }
+        , isFullScreen{ state, ids::fullScreen() }
+        , isMinimised{ state, ids::minimised() }
+        , name{ state, ids::name() }
+        , titleBarHeight{ state, ids::titleBarHeight() }
+        , titleBarButtons{ state, ids::titleBarButtons() }
+        , width{ state, ids::width() }
+        , height{ state, ids::height() }
     {
         const BoxModel::ScopedCallbackLock boxModelLock{ boxModel(*this) };
 
-        if (!hasShadow.exists())
-            hasShadow = true;
-        if (!isNative.exists())
+        hasShadow.setDefault(true);
 #if JIVE_UNIT_TESTS
-            isNative = false;
+        isNative.setDefault(false);
 #else
-            isNative = true;
+        isNative.setDefault(true);
 #endif
 
-        if (!isResizable.exists())
-            isResizable = true;
-        if (!minWidth.exists())
-            minWidth = 1.0f;
-        if (!minHeight.exists())
-            minHeight = 1.0f;
-        if (!maxWidth.exists())
-            maxWidth = static_cast<float>(std::numeric_limits<juce::int16>::max());
-        if (!maxHeight.exists())
-            maxHeight = static_cast<float>(std::numeric_limits<juce::int16>::max());
-        if (!isDraggable.exists())
-            isDraggable = true;
-        if (!name.exists())
-            name = JUCE_APPLICATION_NAME;
-        if (!titleBarHeight.exists())
-            titleBarHeight = 26;
-        if (!titleBarButtons.exists())
-            titleBarButtons = juce::DocumentWindow::allButtons;
+        isResizable.setDefault(true);
+        minWidth.setDefault(1.0f);
+        minHeight.setDefault(1.0f);
+        maxWidth.setDefault(static_cast<float>(std::numeric_limits<juce::int16>::max()));
+        maxHeight.setDefault(static_cast<float>(std::numeric_limits<juce::int16>::max()));
+        isDraggable.setDefault(true);
+        name.setDefault(JUCE_APPLICATION_NAME);
+        titleBarHeight.setDefault(26);
+        titleBarButtons.setDefault(juce::DocumentWindow::allButtons);
 
         hasShadow.onValueChange = [this]() {
             getWindow().setDropShadowEnabled(hasShadow);
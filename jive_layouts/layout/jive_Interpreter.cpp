@@ -32,22 +32,47 @@ namespace jive
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const juce::ValueTree& tree) const
     {
+        JIVE_ACTIVATE_INSTRUMENTATION(instrumentation);
         return interpret(tree, nullptr);
     }
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const juce::XmlElement& xml) const
     {
-        return interpret(parseXML(xml));
+        JIVE_ACTIVATE_INSTRUMENTATION(instrumentation);
+        juce::ValueTree tree;
+
+        {
+            JIVE_INSTRUMENT_PHASE(parsing);
+            tree = parseXML(xml);
+        }
+
+        return interpret(tree);
     }
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const juce::String& xmlString) const
     {
-        return interpret(jive::parseXML(xmlString));
+        JIVE_ACTIVATE_INSTRUMENTATION(instrumentation);
+        juce::ValueTree tree;
+
+        {
+            JIVE_INSTRUMENT_PHASE(parsing);
+            tree = jive::parseXML(xmlString);
+        }
+
+        return interpret(tree);
     }
 
     std::unique_ptr<GuiItem> Interpreter::interpret(const void* xmlStringData, int xmlStringDataSize) const
     {
-        return interpret(parseXML(xmlStringData, xmlStringDataSize));
+        JIVE_ACTIVATE_INSTRUMENTATION(instrumentation);
+        juce::ValueTree tree;
+
+        {
+            JIVE_INSTRUMENT_PHASE(parsing);
+            tree = parseXML(xmlStringData, xmlStringDataSize);
+        }
+
+        return interpret(tree);
     }
 
     void Interpreter::listenTo(GuiItem& item)
@@ -59,6 +84,21 @@ namespace jive
         observedItem->state.addListener(this);
     }
 
+    const Instrumentation& Interpreter::getInstrumentation() const
+    {
+        return instrumentation;
+    }
+
+    Instrumentation& Interpreter::getInstrumentation()
+    {
+        return instrumentation;
+    }
+
+    juce::int64 Interpreter::getNumItemsCreated() const
+    {
+        return numItemsCreated;
+    }
+
     [[nodiscard]] static GuiItem* findItem(GuiItem& root, const juce::ValueTree& state)
     {
         if (root.state == state)
@@ -80,6 +120,7 @@ namespace jive
         {
             if (auto* parentItem = findItem(*observedItem, parentTree))
             {
+                JIVE_ACTIVATE_INSTRUMENTATION(instrumentation);
                 const auto index = parentTree.indexOf(childWhichHasBeenAdded);
                 insertChild(*parentItem, index, childWhichHasBeenAdded);
             }
@@ -88,7 +129,7 @@ namespace jive
 
     static std::unique_ptr<GuiItem> decorateWithDisplayBehaviour(std::unique_ptr<GuiItem> item)
     {
-        Property<Display> display{ item->state, "display" };
+        Property<Display> display{ item->state, ids::display() };
 
         switch (display.get())
         {
@@ -110,7 +151,7 @@ namespace jive
         if (item->getParent() == nullptr)
             return item;
 
-        Property<Display> display{ item->state.getParent(), "display" };
+        Property<Display> display{ item->state.getParent(), ids::display() };
 
         switch (display.get())
         {
@@ -195,7 +236,13 @@ namespace jive
 
         if (item != nullptr)
         {
-            item = decorate(std::move(item), customDecorators);
+            numItemsCreated++;
+
+            {
+                JIVE_INSTRUMENT_PHASE(decoration);
+                item = decorate(std::move(item), customDecorators);
+            }
+
             setChildItems(*item);
         }
 
@@ -204,6 +251,8 @@ namespace jive
 
     void Interpreter::expandAlias(juce::ValueTree& tree) const
     {
+        JIVE_INSTRUMENT_PHASE(aliasExpansion);
+
         if (const auto alias = aliases.find(tree.getType());
             alias != std::end(aliases))
         {
@@ -262,6 +311,7 @@ namespace jive
 
     void Interpreter::setChildItems(GuiItem& item) const
     {
+        JIVE_INSTRUMENT_PHASE(childItems);
         std::vector<std::unique_ptr<GuiItem>> children;
 
         for (auto i = 0; i < item.state.getNumChildren(); i++)
@@ -279,6 +329,7 @@ namespace jive
 
     std::unique_ptr<juce::Component> Interpreter::createComponent(const juce::ValueTree& tree) const
     {
+        JIVE_INSTRUMENT_PHASE(componentCreation);
         const auto name = tree.getType();
         return componentFactory.create(name);
     }
@@ -305,6 +356,7 @@ public:
         testInterpretingDifferentSources();
         testInterpretingContentAndContainers();
         testListening();
+        testInstrumentation();
     }
 
 private:
@@ -725,6 +777,37 @@ private:
         item->state.appendChild(juce::ValueTree{ "Component" }, nullptr);
         expectEquals(item->getChildren().size(), 2);
     }
+
+    void testInstrumentation()
+    {
+        beginTest("instrumentation");
+
+        const jive::Interpreter interpreter;
+        expectEquals(interpreter.getNumItemsCreated(), juce::int64{ 0 });
+
+        const juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 222 },
+                { "height", 333 },
+            },
+            {
+                juce::ValueTree{ "Component" },
+                juce::ValueTree{ "Component" },
+            },
+        };
+        auto view = interpreter.interpret(tree);
+        expectEquals(interpreter.getNumItemsCreated(), juce::int64{ 3 });
+
+        view = interpreter.interpret(tree);
+        expectEquals(interpreter.getNumItemsCreated(), juce::int64{ 6 });
+
+#if JIVE_ENABLE_INSTRUMENTATION
+        expectEquals(interpreter.getInstrumentation().getNumCalls(jive::Instrumentation::Phase::decoration), 6);
+#else
+        expectEquals(interpreter.getInstrumentation().getNumCalls(jive::Instrumentation::Phase::decoration), 0);
+#endif
+    }
 };
 
 static ViewRendererUnitTest viewRendererUnitTest;
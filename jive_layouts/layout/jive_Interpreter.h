@@ -23,6 +23,20 @@ namespace jive
 
         void listenTo(GuiItem& item);
 
+        /** Returns the per-phase totals accumulated by this interpreter.
+
+            Totals are only recorded when JIVE_ENABLE_INSTRUMENTATION is
+            enabled, and accumulate across calls to interpret() until
+            Instrumentation::reset() is called.
+        */
+        const Instrumentation& getInstrumentation() const;
+        Instrumentation& getInstrumentation();
+
+        /** Returns the number of items this interpreter has created, which,
+            unlike its instrumentation, is always counted.
+        */
+        [[nodiscard]] juce::int64 getNumItemsCreated() const;
+
     private:
         void valueTreeChildAdded(juce::ValueTree& parentTree,
                                  juce::ValueTree& childWhichHasBeenAdded) final;
@@ -43,6 +57,9 @@ namespace jive
 
         GuiItem* observedItem = nullptr;
 
+        mutable Instrumentation instrumentation;
+        mutable juce::int64 numItemsCreated = 0;
+
         JUCE_LEAK_DETECTOR(Interpreter)
     };
 } // namespace jive
@@ -0,0 +1,283 @@
+#include <jive_layouts/jive_layouts.h>
+
+namespace jive
+{
+    [[nodiscard]] static auto& getSchedulers()
+    {
+        static std::vector<LayoutScheduler*> schedulers;
+        return schedulers;
+    }
+
+    [[nodiscard]] static int getDepth(juce::ValueTree tree)
+    {
+        auto depth = 0;
+
+        for (tree = tree.getParent(); tree.isValid(); tree = tree.getParent())
+            depth++;
+
+        return depth;
+    }
+
+    LayoutScheduler::LayoutScheduler(GuiItem& rootItem)
+        : tree{ rootItem.state }
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+        getSchedulers().push_back(this);
+    }
+
+    LayoutScheduler::~LayoutScheduler()
+    {
+        flushLayout();
+
+        auto& schedulers = getSchedulers();
+        schedulers.erase(std::remove(std::begin(schedulers),
+                                     std::end(schedulers),
+                                     this),
+                         std::end(schedulers));
+    }
+
+    void LayoutScheduler::flushLayout()
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        cancelPendingUpdate();
+
+        // Laying out an item resizes its children, which in turn marks them
+        // to be laid out. Those are collected into the next round, so each
+        // round lays out one more level of the tree.
+        while (!pending.empty())
+        {
+            std::vector<std::pair<int, GuiItem*>> round;
+            round.reserve(pending.size());
+
+            for (auto* item : pending)
+            {
+                if (item != nullptr)
+                    round.emplace_back(getDepth(item->state), item);
+            }
+
+            pending.clear();
+            std::stable_sort(std::begin(round),
+                             std::end(round),
+                             [](const auto& a, const auto& b) {
+                                 return a.first < b.first;
+                             });
+
+            flushing.clear();
+
+            for (const auto& entry : round)
+                flushing.push_back(entry.second);
+
+            for (std::size_t i = 0; i < flushing.size(); i++)
+            {
+                // Earlier layouts may have destroyed later items.
+                if (auto* item = flushing[i])
+                {
+                    flushing[i] = nullptr;
+                    scheduled.erase(item);
+                    item->layOutChildren();
+                }
+            }
+
+            flushing.clear();
+        }
+    }
+
+    void LayoutScheduler::requestLayout(GuiItem& item)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        for (auto* scheduler : getSchedulers())
+        {
+            if (scheduler->covers(item))
+            {
+                scheduler->markForLayout(item);
+                return;
+            }
+        }
+
+        // Within a transaction, the item is laid out once all of the
+        // transaction's property changes have been responded to, rather than
+        // once for each of them.
+        if (PropertyTransaction::deferUntilSettled(item.deferredLayout))
+            return;
+
+        item.layOutChildren();
+    }
+
+    void LayoutScheduler::cancel(GuiItem& item)
+    {
+        JUCE_ASSERT_MESSAGE_THREAD
+
+        for (auto* scheduler : getSchedulers())
+        {
+            if (scheduler->scheduled.erase(&item) == 0)
+                continue;
+
+            std::replace(std::begin(scheduler->pending),
+                         std::end(scheduler->pending),
+                         &item,
+                         static_cast<GuiItem*>(nullptr));
+            std::replace(std::begin(scheduler->flushing),
+                         std::end(scheduler->flushing),
+                         &item,
+                         static_cast<GuiItem*>(nullptr));
+        }
+    }
+
+    bool LayoutScheduler::covers(const GuiItem& item) const
+    {
+        return item.state == tree || item.state.isAChildOf(tree);
+    }
+
+    void LayoutScheduler::markForLayout(GuiItem& item)
+    {
+        // An item that's still waiting to be laid out will be laid out with
+        // the latest state anyway. Checking the set, rather than searching
+        // the queues, keeps a burst of requests linear in its size.
+        if (!scheduled.insert(&item).second)
+            return;
+
+        pending.push_back(&item);
+        triggerAsyncUpdate();
+    }
+
+    void LayoutScheduler::handleAsyncUpdate()
+    {
+        flushLayout();
+    }
+} // namespace jive
+
+#if JIVE_UNIT_TESTS
+class LayoutSchedulerUnitTest : public juce::UnitTest
+{
+public:
+    LayoutSchedulerUnitTest()
+        : juce::UnitTest{ "jive::LayoutScheduler", "jive" }
+    {
+    }
+
+    void runTest() final
+    {
+        testDeferral();
+        testTransactions();
+        testDestroyingItems();
+    }
+
+private:
+    void testDeferral()
+    {
+        beginTest("deferral");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 200 },
+                { "flex-direction", "row" },
+            },
+            {
+                juce::ValueTree{ "Component", { { "width", 50 }, { "height", 50 } } },
+                juce::ValueTree{ "Component", { { "width", 50 }, { "height", 50 } } },
+            },
+        };
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(tree);
+        const auto& secondChild = *item->getChildren()[1]->getComponent();
+        expectEquals(secondChild.getX(), 50);
+
+        {
+            jive::LayoutScheduler scheduler{ *item };
+            tree.getChild(0).setProperty("width", 60, nullptr);
+            tree.getChild(0).setProperty("width", 70, nullptr);
+            tree.setProperty("flex-direction", "row-reverse", nullptr);
+            tree.setProperty("flex-direction", "row", nullptr);
+            expectEquals(secondChild.getX(), 50);
+
+            scheduler.flushLayout();
+            expectEquals(secondChild.getX(), 70);
+
+            tree.getChild(0).setProperty("width", 80, nullptr);
+        }
+
+        expectEquals(secondChild.getX(), 80);
+    }
+
+    void testTransactions()
+    {
+        beginTest("transactions");
+
+        struct LayoutCounter : public jive::GuiItemDecorator
+        {
+            using jive::GuiItemDecorator::GuiItemDecorator;
+
+            void layOutChildren() final
+            {
+                numLayouts++;
+                jive::GuiItemDecorator::layOutChildren();
+            }
+
+            int numLayouts = 0;
+        };
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 200 },
+                { "flex-direction", "row" },
+            },
+            {
+                juce::ValueTree{ "Component", { { "width", 50 }, { "height", 50 } } },
+                juce::ValueTree{ "Component", { { "width", 50 }, { "height", 50 } } },
+            },
+        };
+        jive::Interpreter interpreter;
+        interpreter.addDecorator<LayoutCounter>("Component");
+        auto item = interpreter.interpret(tree);
+        auto& counter = *dynamic_cast<jive::GuiItemDecorator&>(*item).toType<LayoutCounter>();
+        const auto& secondChild = *item->getChildren()[1]->getComponent();
+        const auto numLayoutsBefore = counter.numLayouts;
+
+        {
+            const jive::PropertyTransaction transaction{ tree };
+            tree.getChild(0).setProperty("width", 60, nullptr);
+            tree.getChild(0).setProperty("width", 70, nullptr);
+            tree.getChild(1).setProperty("flex-grow", 1, nullptr);
+            tree.setProperty("flex-direction", "row-reverse", nullptr);
+            tree.setProperty("flex-direction", "row", nullptr);
+            expectEquals(counter.numLayouts, numLayoutsBefore);
+        }
+
+        expectEquals(counter.numLayouts, numLayoutsBefore + 1);
+        expectEquals(secondChild.getX(), 70);
+    }
+
+    void testDestroyingItems()
+    {
+        beginTest("destroying items");
+
+        juce::ValueTree tree{
+            "Component",
+            {
+                { "width", 200 },
+                { "height", 200 },
+            },
+            {
+                juce::ValueTree{ "Component", {}, { juce::ValueTree{ "Component" } } },
+            },
+        };
+        jive::Interpreter interpreter;
+        auto item = interpreter.interpret(tree);
+        jive::LayoutScheduler scheduler{ *item };
+
+        tree.getChild(0).getChild(0).setProperty("width", 10, nullptr);
+        tree.removeChild(0, nullptr);
+        scheduler.flushLayout();
+
+        expect(item->getChildren().isEmpty());
+    }
+};
+
+static LayoutSchedulerUnitTest layoutSchedulerUnitTest;
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+namespace jive
+{
+    /** Defers laying out the items within a root item, so that any number of
+        changes are laid out in a single pass.
+
+        While a scheduler exists, an item within its root that needs laying
+        out is marked as such rather than being laid out immediately. All the
+        marked items are then laid out on the next turn of the message loop,
+        parents before their children, each once. Any layouts those cause are
+        laid out in the same pass.
+
+        Until then, the bounds of the affected components will be out of
+        date. Call flushLayout() to lay out any marked items immediately, for
+        example before reading those bounds.
+
+        Schedulers, and the static functions below, may only be used on the
+        message thread.
+    */
+    class LayoutScheduler : private juce::AsyncUpdater
+    {
+    public:
+        explicit LayoutScheduler(GuiItem& rootItem);
+        ~LayoutScheduler() override;
+
+        /** Lays out all of the items waiting to be laid out. */
+        void flushLayout();
+
+        /** Lays out the children of the given item, or marks it to be laid
+            out later if a scheduler covers it. Otherwise, if a
+            PropertyTransaction covers it, it's laid out once that transaction
+            has settled.
+        */
+        static void requestLayout(GuiItem& item);
+
+        /** Forgets about the given item if it's waiting to be laid out. */
+        static void cancel(GuiItem& item);
+
+    private:
+        [[nodiscard]] bool covers(const GuiItem& item) const;
+        void markForLayout(GuiItem& item);
+
+        void handleAsyncUpdate() final;
+
+        const juce::ValueTree tree;
+        std::vector<GuiItem*> pending;
+        std::vector<GuiItem*> flushing;
+        std::unordered_set<GuiItem*> scheduled;
+
+        JUCE_DECLARE_NON_COPYABLE(LayoutScheduler)
+        JUCE_LEAK_DETECTOR(LayoutScheduler)
+    };
+} // namespace jive
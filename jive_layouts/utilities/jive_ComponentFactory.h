@@ -1,18 +1,5 @@
 #pragma once
 
-namespace std
-{
-    template <>
-    class hash<juce::Identifier>
-    {
-    public:
-        std::size_t operator()(const juce::Identifier& id) const
-        {
-            return id.toString().hash();
-        }
-    };
-} // namespace std
-
 namespace jive
 {
     class ComponentFactory
@@ -2,17 +2,6 @@
 
 namespace jive
 {
-    namespace fontProperties
-    {
-        static const juce::Identifier fontFamily{ "font-family" };
-        static const juce::Identifier fontStyle{ "font-style" };
-        static const juce::Identifier fontWeight{ "font-weight" };
-        static const juce::Identifier fontSize{ "font-size" };
-        static const juce::Identifier letterSpacing{ "letter-spacing" };
-        static const juce::Identifier textDecoration{ "text-decoration" };
-        static const juce::Identifier fontStretch{ "font-stretch" };
-    } // namespace fontProperties
-
     [[nodiscard]] static auto getAncestorTypes(const juce::ValueTree& child)
     {
         juce::StringArray types;
@@ -32,11 +21,11 @@ namespace jive
     public:
         explicit Selectors(const juce::ValueTree& sourceState)
             : state{ sourceState }
-            , id{ state, "id" }
-            , classes{ state, "class" }
-            , enabled{ state, "enabled" }
-            , mouse{ state, "mouse" }
-            , keyboard{ state, "keyboard" }
+            , id{ state, ids::id() }
+            , classes{ state, ids::classes() }
+            , enabled{ state, ids::enabled() }
+            , mouse{ state, ids::mouse() }
+            , keyboard{ state, ids::keyboard() }
         {
             const auto informListeners = [this]() {
                 if (onChange != nullptr)
@@ -98,14 +87,14 @@ namespace jive
         , state{ sourceState }
         , stateRoot{ state.getRoot() }
         , interactionState{ sourceComponent, state }
-        , style{ state, "style" }
-        , borderWidth{ state, "border-width" }
+        , style{ state, ids::style() }
+        , borderWidth{ state, ids::borderWidth() }
         , selectors{ std::make_unique<Selectors>(state) }
     {
         jassert(component != nullptr);
-        jassert(!component->getProperties().contains("style-sheet"));
+        jassert(!component->getProperties().contains(ids::styleSheet()));
 
-        component->getProperties().set("style-sheet", juce::var{ this });
+        component->getProperties().set(ids::styleSheet(), juce::var{ this });
         component->addAndMakeVisible(backgroundCanvas, 0);
         backgroundCanvas.setBounds(component->getLocalBounds());
 
@@ -134,7 +123,7 @@ namespace jive
         if (component != nullptr)
         {
             component->removeComponentListener(this);
-            component->getProperties().remove("style-sheet");
+            component->getProperties().remove(ids::styleSheet());
         }
 
         if (auto object = style.get();
@@ -146,66 +135,66 @@ namespace jive
 
     Fill StyleSheet::getBackground() const
     {
-        return juce::VariantConverter<Fill>::fromVar(findStyleProperty("background"));
+        return juce::VariantConverter<Fill>::fromVar(findStyleProperty(ids::background()));
     }
 
     Fill StyleSheet::getForeground() const
     {
-        return juce::VariantConverter<Fill>::fromVar(findHierarchicalStyleProperty("foreground"));
+        return juce::VariantConverter<Fill>::fromVar(findHierarchicalStyleProperty(ids::foreground()));
     }
 
     Fill StyleSheet::getBorderFill() const
     {
-        return juce::VariantConverter<Fill>::fromVar(findStyleProperty("border"));
+        return juce::VariantConverter<Fill>::fromVar(findStyleProperty(ids::border()));
     }
 
     BorderRadii<float> StyleSheet::getBorderRadii() const
     {
-        return juce::VariantConverter<BorderRadii<float>>::fromVar(findStyleProperty("border-radius"));
+        return juce::VariantConverter<BorderRadii<float>>::fromVar(findStyleProperty(ids::borderRadius()));
     }
 
     juce::Font StyleSheet::getFont() const
     {
         juce::Font font;
 
-        if (const auto fontFamily = findHierarchicalStyleProperty(fontProperties::fontFamily).toString();
+        if (const auto fontFamily = findHierarchicalStyleProperty(ids::fontFamily()).toString();
             fontFamily.isNotEmpty())
         {
             font.setTypefaceName(fontFamily);
         }
 
-        if (const auto fontStyle = findHierarchicalStyleProperty(fontProperties::fontStyle).toString();
+        if (const auto fontStyle = findHierarchicalStyleProperty(ids::fontStyle()).toString();
             fontStyle.isNotEmpty())
         {
             font.setItalic(fontStyle.compareIgnoreCase("italic") == 0);
         }
 
-        if (const auto weight = findHierarchicalStyleProperty(fontProperties::fontWeight).toString();
+        if (const auto weight = findHierarchicalStyleProperty(ids::fontWeight()).toString();
             weight.isNotEmpty())
         {
             font.setBold(weight.compareIgnoreCase("bold") == 0);
         }
 
-        if (const auto size = findHierarchicalStyleProperty(fontProperties::fontSize);
+        if (const auto size = findHierarchicalStyleProperty(ids::fontSize());
             size != juce::var{})
         {
             font = font.withPointHeight(static_cast<float>(size));
         }
 
-        if (const auto spacing = findHierarchicalStyleProperty(fontProperties::letterSpacing);
+        if (const auto spacing = findHierarchicalStyleProperty(ids::letterSpacing());
             spacing != juce::var{})
         {
             const auto extraKerning = static_cast<float>(spacing) / font.getHeight();
             font.setExtraKerningFactor(extraKerning);
         }
 
-        if (const auto decoration = findHierarchicalStyleProperty(fontProperties::textDecoration).toString();
+        if (const auto decoration = findHierarchicalStyleProperty(ids::textDecoration()).toString();
             decoration.isNotEmpty())
         {
             font.setUnderline(decoration.compareIgnoreCase("underlined") == 0);
         }
 
-        if (const auto stretch = findHierarchicalStyleProperty(fontProperties::fontStretch);
+        if (const auto stretch = findHierarchicalStyleProperty(ids::fontStretch());
             stretch != juce::var{})
         {
             font.setHorizontalScale(static_cast<float>(stretch));
@@ -230,7 +219,7 @@ namespace jive
 
     void StyleSheet::valueTreePropertyChanged(juce::ValueTree&, const juce::Identifier& id)
     {
-        if (id == juce::Identifier{ "style" })
+        if (id == ids::style())
         {
             if (auto object = style.get();
                 object != nullptr)
@@ -288,7 +277,7 @@ namespace jive
     {
         jassert(state.isValid());
 
-        if (auto object = Property<Object::ReferenceCountedPointer>{ state, "style" }.get())
+        if (auto object = Property<Object::ReferenceCountedPointer>{ state, ids::style() }.get())
         {
             return findStyleProperty<strategy>(*object.get(),
                                                selectors,
@@ -336,9 +325,9 @@ namespace jive
              parent = parent->getParentComponent())
         {
             if (auto& properties = parent->getProperties();
-                properties.contains("style-sheet"))
+                properties.contains(ids::styleSheet()))
             {
-                return dynamic_cast<StyleSheet*>(properties["style-sheet"].getObject());
+                return dynamic_cast<StyleSheet*>(properties[ids::styleSheet()].getObject());
             }
         }
 
@@ -353,8 +342,8 @@ namespace jive
         {
             auto& properties = child->getProperties();
 
-            if (properties.contains("style-sheet"))
-                result.add(dynamic_cast<StyleSheet*>(properties["style-sheet"].getObject()));
+            if (properties.contains(ids::styleSheet()))
+                result.add(dynamic_cast<StyleSheet*>(properties[ids::styleSheet()].getObject()));
         }
 
         return result;
@@ -362,6 +351,8 @@ namespace jive
 
     void StyleSheet::applyStyles()
     {
+        JIVE_INSTRUMENT_PHASE(styling);
+
         backgroundCanvas.setFill(getBackground());
         backgroundCanvas.setBorderFill(getBorderFill());
         backgroundCanvas.setBorderWidth(borderWidth.get());
@@ -379,7 +370,7 @@ namespace jive
         }
         if (state.getType().toString().compareIgnoreCase("svg") == 0)
         {
-            state.setProperty("fill",
+            state.setProperty(ids::fill(),
                               "#" + foreground.getColour()->toDisplayString(false),
                               nullptr);
         }
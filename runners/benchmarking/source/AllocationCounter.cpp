@@ -0,0 +1,150 @@
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+#if JUCE_WINDOWS
+    #include <malloc.h>
+#endif
+
+void* operator new(std::size_t size)
+{
+    AllocationCounter::recordAllocation(size);
+
+    if (auto* memory = std::malloc(size == 0 ? 1 : size))
+        return memory;
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    AllocationCounter::recordAllocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    AllocationCounter::recordAllocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    std::free(memory);
+}
+
+// Over-aligned types are allocated through the std::align_val_t overloads,
+// which must be replaced as well or their allocations wouldn't be counted.
+// Memory they allocate has to be freed by the matching aligned deletes.
+static void* allocateAligned(std::size_t size, std::align_val_t alignment) noexcept
+{
+    size = size == 0 ? 1 : size;
+
+#if JUCE_WINDOWS
+    return _aligned_malloc(size, static_cast<std::size_t>(alignment));
+#else
+    void* memory = nullptr;
+
+    if (posix_memalign(&memory, static_cast<std::size_t>(alignment), size) != 0)
+        return nullptr;
+
+    return memory;
+#endif
+}
+
+static void freeAligned(void* memory) noexcept
+{
+#if JUCE_WINDOWS
+    _aligned_free(memory);
+#else
+    std::free(memory);
+#endif
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    AllocationCounter::recordAllocation(size);
+
+    if (auto* memory = allocateAligned(size, alignment))
+        return memory;
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    AllocationCounter::recordAllocation(size);
+    return allocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    AllocationCounter::recordAllocation(size);
+    return allocateAligned(size, alignment);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    freeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    freeAligned(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    freeAligned(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    freeAligned(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    freeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    freeAligned(memory);
+}
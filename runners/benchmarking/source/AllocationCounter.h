@@ -0,0 +1,62 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <atomic>
+
+/** Counts the heap allocations made through the global operator new,
+    including its over-aligned overloads, all of which the benchmarking runner
+    replaces in AllocationCounter.cpp.
+
+    Counting is disabled by default so that benchmarks which aren't interested
+    in allocations only pay for a single relaxed load per allocation.
+*/
+class AllocationCounter
+{
+public:
+    struct Totals
+    {
+        juce::int64 numAllocations = 0;
+        juce::int64 numBytes = 0;
+
+        Totals operator-(const Totals& other) const
+        {
+            return {
+                numAllocations - other.numAllocations,
+                numBytes - other.numBytes,
+            };
+        }
+    };
+
+    static void setEnabled(bool shouldBeEnabled)
+    {
+        enabled.store(shouldBeEnabled, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static bool isEnabled()
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] static Totals getTotals()
+    {
+        return {
+            numAllocations.load(std::memory_order_relaxed),
+            numBytes.load(std::memory_order_relaxed),
+        };
+    }
+
+    static void recordAllocation(std::size_t size)
+    {
+        if (!isEnabled())
+            return;
+
+        numAllocations.fetch_add(1, std::memory_order_relaxed);
+        numBytes.fetch_add(static_cast<juce::int64>(size), std::memory_order_relaxed);
+    }
+
+private:
+    static inline std::atomic<bool> enabled{ false };
+    static inline std::atomic<juce::int64> numAllocations{ 0 };
+    static inline std::atomic<juce::int64> numBytes{ 0 };
+};
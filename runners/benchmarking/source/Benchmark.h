@@ -1,93 +1,287 @@
 #pragma once
 
+#include "AllocationCounter.h"
+#include "Statistics.h"
+
 #include <jive_layouts/jive_layouts.h>
 
 class Benchmark
 {
 public:
-    explicit Benchmark(juce::String testDescription,
-                       juce::RelativeTime testDuration)
-        : description{ testDescription }
+    struct Metric
+    {
+        juce::String name;
+        double valuePerIteration;
+        bool isPerIteration = true;
+    };
+
+    struct Result
+    {
+        juce::String name;
+        juce::String description;
+        Statistics milliseconds;
+        std::vector<Metric> metrics;
+        juce::String family;
+        int problemSize = 0;
+    };
+
+    Benchmark(juce::String benchmarkName,
+              juce::String testDescription,
+              juce::RelativeTime testDuration)
+        : name{ benchmarkName }
+        , description{ testDescription }
         , duration{ testDuration }
     {
     }
 
-    explicit Benchmark(juce::String testDescription, int numIterations)
-        : description{ testDescription }
+    Benchmark(juce::String benchmarkName,
+              juce::String testDescription,
+              int numIterations)
+        : name{ benchmarkName }
+        , description{ testDescription }
         , iterations{ numIterations }
     {
     }
 
-    void run()
+    virtual ~Benchmark() = default;
+
+    [[nodiscard]] const juce::String& getName() const
+    {
+        return name;
+    }
+
+    void setNumWarmUpIterations(int numIterations)
     {
-        std::cout << "Test:       " << description << "\n";
+        jassert(numIterations >= 0);
+        numWarmUpIterations = numIterations;
+    }
+
+    /** Benchmarks that aren't run by default are only run when they're
+        explicitly selected with a filter.
+    */
+    [[nodiscard]] virtual bool isRunByDefault() const
+    {
+        return true;
+    }
+
+    Result run()
+    {
+        std::cout << "Test:       " << description << " (" << name << ")\n";
+
+        jive::Interpreter interpreter;
+        setUp(interpreter);
+        warmUp(interpreter);
+        interpreter.getInstrumentation().reset();
 
         if (duration.has_value())
-            doTimeboxedRun();
+            doTimeboxedRun(interpreter);
         if (iterations.has_value())
-            doIterativeRun();
+            doIterativeRun(interpreter);
+
+        Result result{
+            name,
+            description,
+            Statistics::fromSamples(samples),
+            collectPhaseMetrics(interpreter.getInstrumentation()),
+            family,
+            problemSize,
+        };
+        appendAllocationMetrics(result);
+        appendMetrics(result);
+        printResult(result);
+        samples.clear();
+        allocations = {};
+        numItemsCreated = 0;
+        tearDown();
 
         std::cout << juce::String::repeatedString(juce::CharPointer_UTF8{ "\xe2\x95\x90" }, columnWidth) << "\n\n";
+
+        return result;
     }
 
 protected:
+    /** Called once before any iterations are run, outside of any timing. */
+    virtual void setUp(jive::Interpreter&) {}
+
+    /** Called before each iteration, outside of its timing. */
+    virtual void prepareIteration(jive::Interpreter&) {}
+
     virtual void doIteration(jive::Interpreter& interpreter) = 0;
 
+    /** Called once after all iterations have been run. */
+    virtual void tearDown() {}
+
+    /** Override to add any metrics of your own to the result of a run. */
+    virtual void appendMetrics(Result&) const {}
+
+    /** Marks this benchmark as one of a family of benchmarks measuring the same
+        thing over increasing problem sizes, so that the complexity of the
+        family can be estimated.
+    */
+    void setProblemSize(const juce::String& familyName, int size)
+    {
+        family = familyName;
+        problemSize = size;
+    }
+
 private:
     void printProgress(double progressNormalised)
     {
         std::cout << "\r" << jive::buildProgressBar(progressNormalised, columnWidth) << std::flush;
     }
 
-    void printResult(int counter, juce::RelativeTime elapsed)
+    void printResult(const Result& result)
     {
+        const auto& statistics = result.milliseconds;
+
         std::cout << "\n\n"
-                  << "Completed:  " << counter << " iterations\n"
-                  << "Average:    " << static_cast<double>(elapsed.inMilliseconds()) / static_cast<double>(counter) << "ms\n\n";
+                  << "Completed:  " << samples.size() << " iterations ("
+                  << statistics.numOutliers << " outliers excluded from the mean)\n"
+                  << "Mean:       " << statistics.mean << "ms (\xc2\xb1" << statistics.standardDeviation << "ms)\n"
+                  << "Min:        " << statistics.min << "ms\n"
+                  << "Median:     " << statistics.median << "ms\n"
+                  << "P95:        " << statistics.p95 << "ms\n"
+                  << "P99:        " << statistics.p99 << "ms\n"
+                  << "Max:        " << statistics.max << "ms\n\n";
+
+        for (const auto& metric : result.metrics)
+            std::cout << metric.name << ": " << metric.valuePerIteration << (metric.isPerIteration ? " per iteration" : "") << "\n";
+
+        if (!result.metrics.empty())
+            std::cout << "\n";
     }
 
-    void doTimeboxedRun()
+    [[nodiscard]] std::vector<Metric> collectPhaseMetrics(const jive::Instrumentation& instrumentation) const
     {
-        std::cout << "Duration:   " << duration->getDescription() << "\n\n";
+        std::vector<Metric> metrics;
 
-        jive::Interpreter interpreter;
-        auto counter = 0;
-        const auto start = juce::Time::getCurrentTime();
+#if JIVE_ENABLE_INSTRUMENTATION
+        const auto numIterations = static_cast<double>(juce::jmax<std::size_t>(1, samples.size()));
 
-        for (auto elapsed = juce::Time::getCurrentTime() - start;
-             elapsed <= duration.value();
-             elapsed = juce::Time::getCurrentTime() - start)
+        for (auto i = 0; i < jive::Instrumentation::numPhases; i++)
         {
+            const auto phase = static_cast<jive::Instrumentation::Phase>(i);
+            const auto phaseName = jive::Instrumentation::getName(phase);
+
+            metrics.push_back({
+                phaseName + ".milliseconds",
+                instrumentation.getTotalMilliseconds(phase) / numIterations,
+            });
+            metrics.push_back({
+                phaseName + ".calls",
+                instrumentation.getNumCalls(phase) / numIterations,
+            });
+        }
+#else
+        juce::ignoreUnused(instrumentation);
+#endif
+
+        return metrics;
+    }
+
+    void appendAllocationMetrics(Result& result) const
+    {
+        if (!AllocationCounter::isEnabled())
+            return;
+
+        const auto numIterations = static_cast<double>(juce::jmax<std::size_t>(1, samples.size()));
+        result.metrics.push_back({
+            "allocations",
+            static_cast<double>(allocations.numAllocations) / numIterations,
+        });
+        result.metrics.push_back({
+            "allocated-bytes",
+            static_cast<double>(allocations.numBytes) / numIterations,
+        });
+
+        // Benchmarks that don't create any items, e.g. those that only mutate
+        // a view, have no per-item allocations to report.
+        if (numItemsCreated > 0)
+        {
+            result.metrics.push_back({
+                "allocations-per-item",
+                static_cast<double>(allocations.numAllocations) / static_cast<double>(numItemsCreated),
+            });
+            result.metrics.push_back({
+                "allocated-bytes-per-item",
+                static_cast<double>(allocations.numBytes) / static_cast<double>(numItemsCreated),
+            });
+        }
+    }
+
+    void warmUp(jive::Interpreter& interpreter)
+    {
+        std::cout << "Warm-up:    " << numWarmUpIterations << " iterations\n";
+
+        for (auto i = 0; i < numWarmUpIterations; i++)
+        {
+            prepareIteration(interpreter);
             doIteration(interpreter);
-            counter++;
-            printProgress(elapsed.inSeconds() / duration->inSeconds());
         }
+    }
 
-        printProgress(1.0);
-        printResult(counter, *duration);
+    void doTimedIteration(jive::Interpreter& interpreter)
+    {
+        prepareIteration(interpreter);
+
+        JIVE_ACTIVATE_INSTRUMENTATION(interpreter.getInstrumentation());
+
+        const auto numItemsBefore = interpreter.getNumItemsCreated();
+        const auto allocationsBefore = AllocationCounter::getTotals();
+        const auto start = juce::Time::getHighResolutionTicks();
+        doIteration(interpreter);
+        const auto end = juce::Time::getHighResolutionTicks();
+        const auto allocationsDuringIteration = AllocationCounter::getTotals() - allocationsBefore;
+        numItemsCreated += interpreter.getNumItemsCreated() - numItemsBefore;
+
+        samples.push_back(juce::Time::highResolutionTicksToSeconds(end - start) * 1000.0);
+        allocations.numAllocations += allocationsDuringIteration.numAllocations;
+        allocations.numBytes += allocationsDuringIteration.numBytes;
     }
 
-    void doIterativeRun()
+    void doTimeboxedRun(jive::Interpreter& interpreter)
     {
-        std::cout << "Iterations: " << *iterations << "\n";
+        std::cout << "Duration:   " << duration->getDescription() << "\n\n";
 
-        jive::Interpreter interpreter;
-        const auto start = juce::Time::getCurrentTime();
+        const auto start = juce::Time::getHighResolutionTicks();
+        const auto elapsedSeconds = [start]() {
+            return juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - start);
+        };
+
+        for (auto elapsed = elapsedSeconds();
+             elapsed <= duration->inSeconds();
+             elapsed = elapsedSeconds())
+        {
+            doTimedIteration(interpreter);
+            printProgress(juce::jmin(1.0, elapsed / duration->inSeconds()));
+        }
+
+        printProgress(1.0);
+    }
+
+    void doIterativeRun(jive::Interpreter& interpreter)
+    {
+        std::cout << "Iterations: " << *iterations << "\n\n";
 
         for (auto i = 0; i < *iterations;)
         {
-            doIteration(interpreter);
+            doTimedIteration(interpreter);
             i++;
             printProgress(i / static_cast<double>(*iterations));
         }
-
-        const auto elapsed = juce::Time::getCurrentTime() - start;
-        printResult(*iterations, elapsed);
     }
 
+    const juce::String name;
     const juce::String description;
     const std::optional<juce::RelativeTime> duration;
     const std::optional<int> iterations;
+    int numWarmUpIterations = 10;
+    juce::String family;
+    int problemSize = 0;
+
+    std::vector<double> samples;
+    AllocationCounter::Totals allocations;
+    juce::int64 numItemsCreated = 0;
 
     static constexpr int columnWidth = 50;
 };
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Benchmark.h"
+
+class BlockStressTest : public Benchmark
+{
+public:
+    BlockStressTest()
+        : Benchmark{
+            "BlockStressTest",
+            "jive::BlockContainer Stress Test",
+            juce::RelativeTime::seconds(30.0),
+        }
+    {
+    }
+
+protected:
+    void doIteration(jive::Interpreter& interpreter) final
+    {
+        static constexpr auto block = [] {
+            return juce::ValueTree{
+                "Component",
+                {
+                    { "display", "block" },
+                    { "width", "20%" },
+                    { "height", "20%" },
+                    { "padding", 5 },
+                },
+                {
+                    juce::ValueTree{
+                        "Component",
+                        {
+                            { "width", "50%" },
+                            { "height", 10 },
+                            { "centre-x", "50%" },
+                        },
+                    },
+                    juce::ValueTree{
+                        "Component",
+                        {
+                            { "width", 10 },
+                            { "height", "25%" },
+                            { "x", "75%" },
+                            { "y", "10%" },
+                        },
+                    },
+                },
+            };
+        };
+        juce::ValueTree view{
+            "Component",
+            {
+                { "id", "top-level" },
+                { "width", 540 },
+                { "height", 360 },
+                { "display", "block" },
+                { "padding", 10 },
+            },
+            {
+                block(),
+                block(),
+                block(),
+                block(),
+                block(),
+                block(),
+                block(),
+                block(),
+                block(),
+            },
+        };
+        const auto item = interpreter.interpret(view);
+
+        for (auto index = 0; index < view.getNumChildren(); index++)
+        {
+            auto child = view.getChild(index);
+
+            child.setProperty("x", juce::String{ index * 10 } + "%", nullptr);
+            child.setProperty("y", juce::String{ index * 5 } + "%", nullptr);
+            child.setProperty("centre-x", "50%", nullptr);
+            child.setProperty("centre-y", "50%", nullptr);
+            child.setProperty("x", 10 * index, nullptr);
+            child.setProperty("y", 5 * index, nullptr);
+
+            for (auto grandchild : child)
+            {
+                grandchild.setProperty("centre-x", "25%", nullptr);
+                grandchild.setProperty("x", "60%", nullptr);
+                grandchild.setProperty("centre-y", "50%", nullptr);
+            }
+        }
+
+        view.setProperty("padding", 20, nullptr);
+        view.setProperty("border-width", 2, nullptr);
+
+        for (auto width = 540; width >= 180; width -= 60)
+        {
+            view.setProperty("width", width, nullptr);
+            view.setProperty("height", width * 2 / 3, nullptr);
+        }
+    }
+};
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "Benchmark.h"
+
+/** Estimates the complexity of each family of benchmarks by fitting a power
+    law, t = c * n^k, to the median times measured over increasing problem
+    sizes. An exponent of ~1 means the family scales linearly, while ~2 means
+    it's quadratic.
+*/
+class ComplexityAnalysis
+{
+public:
+    struct Point
+    {
+        int problemSize;
+        Statistics milliseconds;
+    };
+
+    struct Family
+    {
+        juce::String name;
+        std::vector<Point> points;
+        std::optional<double> exponent;
+    };
+
+    explicit ComplexityAnalysis(const std::vector<Benchmark::Result>& results)
+    {
+        for (const auto& result : results)
+        {
+            if (result.family.isEmpty() || result.problemSize <= 0)
+                continue;
+
+            auto family = std::find_if(std::begin(families),
+                                       std::end(families),
+                                       [&result](const auto& existing) {
+                                           return existing.name == result.family;
+                                       });
+
+            if (family == std::end(families))
+                family = families.insert(std::end(families), Family{ result.family, {}, std::nullopt });
+
+            family->points.push_back({ result.problemSize, result.milliseconds });
+        }
+
+        for (auto& family : families)
+        {
+            std::sort(std::begin(family.points),
+                      std::end(family.points),
+                      [](const auto& a, const auto& b) {
+                          return a.problemSize < b.problemSize;
+                      });
+            family.exponent = fitExponent(family.points);
+        }
+    }
+
+    [[nodiscard]] const std::vector<Family>& getFamilies() const
+    {
+        return families;
+    }
+
+    [[nodiscard]] juce::StringArray getFamiliesExceeding(double maxExponent) const
+    {
+        juce::StringArray names;
+
+        for (const auto& family : families)
+        {
+            if (family.exponent.has_value() && *family.exponent > maxExponent)
+                names.add(family.name);
+        }
+
+        return names;
+    }
+
+    /** Prints each family's curve as a log-scaled bar chart of median times,
+        followed by the estimated exponent.
+    */
+    void print(double maxExponent) const
+    {
+        if (families.empty())
+            return;
+
+        std::cout << "Complexity\n\n";
+
+        for (const auto& family : families)
+        {
+            std::cout << family.name << "\n";
+
+            const auto slowest = std::max_element(std::begin(family.points),
+                                                  std::end(family.points),
+                                                  [](const auto& a, const auto& b) {
+                                                      return a.milliseconds.median < b.milliseconds.median;
+                                                  });
+
+            for (const auto& point : family.points)
+            {
+                std::cout << juce::String{ point.problemSize }.paddedLeft(' ', 8) << " "
+                          << juce::String::repeatedString("#", getBarLength(point.milliseconds.median, slowest->milliseconds.median))
+                                 .paddedRight(' ', barWidth)
+                          << " " << point.milliseconds.median << "ms\n";
+            }
+
+            if (family.exponent.has_value())
+            {
+                std::cout << "O(n^" << juce::String{ *family.exponent, 2 } << ")";
+
+                if (*family.exponent > maxExponent)
+                    std::cout << " - SUPER-LINEAR";
+
+                std::cout << "\n";
+            }
+
+            std::cout << "\n";
+        }
+    }
+
+    [[nodiscard]] juce::String toCSV() const
+    {
+        juce::StringArray lines;
+        lines.add("family,problem-size,median,p95,exponent");
+
+        for (const auto& family : families)
+        {
+            const auto exponent = family.exponent.has_value()
+                                    ? juce::String{ *family.exponent }
+                                    : juce::String{};
+
+            for (const auto& point : family.points)
+            {
+                lines.add(family.name.quoted()
+                          + "," + juce::String{ point.problemSize }
+                          + "," + juce::String{ point.milliseconds.median }
+                          + "," + juce::String{ point.milliseconds.p95 }
+                          + "," + exponent);
+            }
+        }
+
+        return lines.joinIntoString("\n") + "\n";
+    }
+
+    void writeCSV(const juce::File& file) const
+    {
+        if (file == juce::File{})
+            return;
+
+        if (!file.replaceWithText(toCSV()))
+            std::cerr << "Failed to write complexity curves to " << file.getFullPathName() << "\n";
+    }
+
+private:
+    // Fixed per-iteration overheads dominate the smallest problem sizes, so
+    // they're left out of the fit whenever there are enough larger sizes.
+    [[nodiscard]] static std::optional<double> fitExponent(const std::vector<Point>& points)
+    {
+        static constexpr auto minProblemSizeToFit = 100;
+
+        std::vector<std::pair<double, double>> logPoints;
+
+        for (const auto& point : points)
+        {
+            if (point.milliseconds.median > 0.0)
+                logPoints.emplace_back(std::log(static_cast<double>(point.problemSize)),
+                                       std::log(point.milliseconds.median));
+        }
+
+        const auto numLargePoints = std::count_if(std::begin(points),
+                                                  std::end(points),
+                                                  [](const auto& point) {
+                                                      return point.problemSize >= minProblemSizeToFit
+                                                          && point.milliseconds.median > 0.0;
+                                                  });
+
+        if (numLargePoints >= 2)
+        {
+            logPoints.erase(std::remove_if(std::begin(logPoints),
+                                           std::end(logPoints),
+                                           [](const auto& point) {
+                                               return point.first < std::log(static_cast<double>(minProblemSizeToFit));
+                                           }),
+                            std::end(logPoints));
+        }
+
+        if (logPoints.size() < 2)
+            return std::nullopt;
+
+        auto meanX = 0.0;
+        auto meanY = 0.0;
+
+        for (const auto& [x, y] : logPoints)
+        {
+            meanX += x;
+            meanY += y;
+        }
+
+        meanX /= static_cast<double>(logPoints.size());
+        meanY /= static_cast<double>(logPoints.size());
+
+        auto covariance = 0.0;
+        auto variance = 0.0;
+
+        for (const auto& [x, y] : logPoints)
+        {
+            covariance += (x - meanX) * (y - meanY);
+            variance += (x - meanX) * (x - meanX);
+        }
+
+        if (variance <= 0.0)
+            return std::nullopt;
+
+        return covariance / variance;
+    }
+
+    [[nodiscard]] static int getBarLength(double milliseconds, double maxMilliseconds)
+    {
+        if (milliseconds <= 0.0 || maxMilliseconds <= 0.0)
+            return 0;
+
+        // Bars are log-scaled over six decades so that both ends of a curve
+        // spanning several orders of magnitude remain visible.
+        static constexpr auto numDecades = 6.0;
+        const auto decadesBelowMax = std::log10(maxMilliseconds / milliseconds);
+        const auto normalised = juce::jlimit(0.0, 1.0, 1.0 - decadesBelowMax / numDecades);
+
+        return juce::jmax(1, juce::roundToInt(normalised * barWidth));
+    }
+
+    std::vector<Family> families;
+
+    static constexpr int barWidth = 40;
+};
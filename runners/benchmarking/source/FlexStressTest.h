@@ -7,6 +7,7 @@ class FlexStressTest : public Benchmark
 public:
     FlexStressTest()
         : Benchmark{
+            "FlexStressTest",
             "jive::FlexContainer Stress Test",
             juce::RelativeTime::seconds(30.0),
         }
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Benchmark.h"
+
+class GridStressTest : public Benchmark
+{
+public:
+    GridStressTest()
+        : Benchmark{
+            "GridStressTest",
+            "jive::GridContainer Stress Test",
+            juce::RelativeTime::seconds(30.0),
+        }
+    {
+    }
+
+protected:
+    void doIteration(jive::Interpreter& interpreter) final
+    {
+        // Nested grids have no explicit size, so their ideal size has to be
+        // calculated whenever their content changes.
+        static constexpr auto cell = [] {
+            return juce::ValueTree{
+                "Component",
+                {
+                    { "display", "grid" },
+                    { "grid-template-columns", "1fr 1fr" },
+                    { "gap", "2" },
+                },
+                {
+                    juce::ValueTree{
+                        "Component",
+                        {
+                            { "width", 20 },
+                            { "height", 15 },
+                        },
+                    },
+                    juce::ValueTree{
+                        "Component",
+                        {
+                            { "width", 30 },
+                            { "height", 25 },
+                        },
+                    },
+                    juce::ValueTree{
+                        "Text",
+                        {
+                            { "text", "Quisque hendrerit pharetra libero, nec eleifend felis blandit sed." },
+                        },
+                    },
+                },
+            };
+        };
+        juce::ValueTree view{
+            "Component",
+            {
+                { "id", "top-level" },
+                { "width", 540 },
+                { "height", 360 },
+                { "display", "grid" },
+                { "grid-template-columns", "1fr 1fr 1fr" },
+            },
+            {
+                cell(),
+                cell(),
+                cell(),
+                cell(),
+                cell(),
+                cell(),
+                cell(),
+                cell(),
+                cell(),
+            },
+        };
+        const auto item = interpreter.interpret(view);
+
+        view.setProperty("grid-template-columns", "1fr 2fr 1fr", nullptr);
+        view.setProperty("grid-template-columns", "100px auto 1fr", nullptr);
+        view.setProperty("grid-template-columns", "auto auto auto auto", nullptr);
+        view.setProperty("grid-template-columns", "1fr 1fr 1fr", nullptr);
+        view.setProperty("grid-template-rows", "auto 1fr auto", nullptr);
+        view.setProperty("grid-template-rows", "50px 50px", nullptr);
+        view.setProperty("grid-auto-flow", "column", nullptr);
+        view.setProperty("grid-auto-flow", "row", nullptr);
+        view.setProperty("gap", "5", nullptr);
+        view.setProperty("gap", "5 10", nullptr);
+        view.setProperty("gap", "0", nullptr);
+        view.setProperty("justify-items", "start", nullptr);
+        view.setProperty("justify-items", "centre", nullptr);
+        view.setProperty("justify-items", "stretch", nullptr);
+        view.setProperty("align-items", "end", nullptr);
+        view.setProperty("align-items", "stretch", nullptr);
+
+        for (auto index = 0; index < view.getNumChildren(); index++)
+        {
+            auto child = view.getChild(index);
+
+            child.setProperty("grid-column", juce::String{ index % 3 + 1 } + " / span 2", nullptr);
+            child.setProperty("grid-row", juce::String{ index / 3 + 1 } + " / span 1", nullptr);
+            child.setProperty("gap", "4 8", nullptr);
+            child.setProperty("grid-template-columns", "1fr", nullptr);
+        }
+
+        for (auto child : view)
+        {
+            child.removeProperty("grid-column", nullptr);
+            child.removeProperty("grid-row", nullptr);
+        }
+
+        view.setProperty("grid-template-areas", "a b c", nullptr);
+
+        for (auto index = 0; index < view.getNumChildren(); index++)
+        {
+            auto child = view.getChild(index);
+
+            child.setProperty("grid-area", juce::String::charToString(static_cast<juce::juce_wchar>('a' + index % 3)), nullptr);
+        }
+
+        view.setProperty("grid-template-areas", "a a b c", nullptr);
+
+        for (auto width = 540; width >= 180; width -= 60)
+        {
+            view.setProperty("width", width, nullptr);
+            view.setProperty("height", width * 2 / 3, nullptr);
+        }
+    }
+};
@@ -7,6 +7,7 @@ class MinimumViewBenchmark : public Benchmark
 public:
     MinimumViewBenchmark()
         : Benchmark{
+            "MinimumViewBenchmark",
             "Minimum Possible View",
             juce::RelativeTime::seconds(5.0),
         }
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "Benchmark.h"
+
+/** Measures the latency of changing a single property of a single leaf of a
+    large view, from the property being set to the whole tree having settled.
+
+    Layout in JIVE is synchronous, so the tree has settled once setting the
+    property returns. When built with JIVE_ENABLE_INSTRUMENTATION, the
+    lay-out-children and perform-layout call counts reported per iteration are
+    the number of relayouts, and flex/grid passes, triggered by each mutation.
+*/
+class MutationLatencyBenchmark : public Benchmark
+{
+public:
+    enum class Mutation
+    {
+        width,
+        text,
+        flexGrow,
+        style,
+    };
+
+    explicit MutationLatencyBenchmark(Mutation mutationToMeasure)
+        : Benchmark{
+            "MutationLatency/" + getName(mutationToMeasure),
+            "Latency of Changing a Leaf's " + getName(mutationToMeasure),
+            juce::RelativeTime::seconds(5.0),
+        }
+        , mutation{ mutationToMeasure }
+    {
+    }
+
+    [[nodiscard]] static std::vector<std::unique_ptr<Benchmark>> createSuite()
+    {
+        std::vector<std::unique_ptr<Benchmark>> suite;
+
+        for (const auto mutation : {
+                 Mutation::width,
+                 Mutation::text,
+                 Mutation::flexGrow,
+                 Mutation::style,
+             })
+        {
+            suite.push_back(std::make_unique<MutationLatencyBenchmark>(mutation));
+        }
+
+        return suite;
+    }
+
+protected:
+    void setUp(jive::Interpreter& interpreter) final
+    {
+        view = createView();
+        item = interpreter.interpret(view);
+
+        // A leaf in the middle of the view, so that it has siblings and
+        // ancestors on both sides to be laid out.
+        const auto section = view.getChild(view.getNumChildren() / 2);
+        const auto row = section.getChild(section.getNumChildren() / 2);
+        const auto leafIndex = row.getNumChildren() / 4 * 2;
+        leaf = mutation == Mutation::text
+                 ? row.getChild(leafIndex + 1)
+                 : row.getChild(leafIndex);
+
+        jassert(leaf.hasType(mutation == Mutation::text ? "Text" : "Component"));
+    }
+
+    void doIteration(jive::Interpreter&) final
+    {
+        toggle = !toggle;
+
+        switch (mutation)
+        {
+        case Mutation::width:
+            leaf.setProperty("width", toggle ? 30 : 20, nullptr);
+            break;
+        case Mutation::text:
+            leaf.setProperty("text", toggle ? "Lorem ipsum dolor sit amet" : "Lorem ipsum", nullptr);
+            break;
+        case Mutation::flexGrow:
+            leaf.setProperty("flex-grow", toggle ? 1 : 0, nullptr);
+            break;
+        case Mutation::style:
+            leaf.setProperty("style",
+                             new jive::Object{
+                                 { "background", toggle ? "#FF0000" : "#00FF00" },
+                             },
+                             nullptr);
+            break;
+        }
+    }
+
+    void tearDown() final
+    {
+        item = nullptr;
+        leaf = juce::ValueTree{};
+        view = juce::ValueTree{};
+    }
+
+private:
+    [[nodiscard]] static juce::String getName(Mutation mutation)
+    {
+        switch (mutation)
+        {
+        case Mutation::width:
+            return "width";
+        case Mutation::text:
+            return "text";
+        case Mutation::flexGrow:
+            return "flex-grow";
+        case Mutation::style:
+            return "style";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    // Sections and rows have no explicit size so that a change to any leaf
+    // has to propagate ideal sizes all the way up to the root.
+    [[nodiscard]] static juce::ValueTree createView()
+    {
+        static constexpr auto numSections = 3;
+        static constexpr auto numRowsPerSection = 8;
+        static constexpr auto numLeavesPerRow = 5;
+
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", 800 },
+                { "height", 600 },
+                { "flex-direction", "column" },
+            },
+        };
+
+        for (auto sectionIndex = 0; sectionIndex < numSections; sectionIndex++)
+        {
+            juce::ValueTree section{
+                "Component",
+                {
+                    { "flex-direction", "column" },
+                    { "padding", 4 },
+                },
+            };
+
+            for (auto rowIndex = 0; rowIndex < numRowsPerSection; rowIndex++)
+            {
+                juce::ValueTree row{
+                    "Component",
+                    {
+                        { "flex-direction", "row" },
+                    },
+                };
+
+                for (auto leafIndex = 0; leafIndex < numLeavesPerRow; leafIndex++)
+                {
+                    row.appendChild(juce::ValueTree{
+                                        "Component",
+                                        {
+                                            { "width", 20 },
+                                            { "height", 20 },
+                                        },
+                                    },
+                                    nullptr);
+                    row.appendChild(juce::ValueTree{
+                                        "Text",
+                                        {
+                                            { "text", "Lorem ipsum" },
+                                        },
+                                    },
+                                    nullptr);
+                }
+
+                section.appendChild(row, nullptr);
+            }
+
+            view.appendChild(section, nullptr);
+        }
+
+        return view;
+    }
+
+    const Mutation mutation;
+
+    juce::ValueTree view;
+    std::unique_ptr<jive::GuiItem> item;
+    juce::ValueTree leaf;
+    bool toggle = false;
+};
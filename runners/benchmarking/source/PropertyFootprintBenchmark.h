@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Benchmark.h"
+
+/** Binds a GUI item's worth of properties to a fresh tree, to measure what
+    each property costs.
+
+    Each property's footprint is its own size plus whatever it allocates,
+    reported as bytes-per-property and, when run with --allocations,
+    allocations-per-property and allocated-bytes-per-property. The cost of the
+    tree's dispatcher, shared by all of its properties, is spread over them.
+*/
+class PropertyFootprintBenchmark : public Benchmark
+{
+public:
+    PropertyFootprintBenchmark()
+        : Benchmark{
+            "PropertyFootprint",
+            "Binding Properties to a Tree",
+            juce::RelativeTime::seconds(5.0),
+        }
+    {
+    }
+
+protected:
+    void setUp(jive::Interpreter&) final
+    {
+        for (auto i = 0; i < numProperties; i++)
+            ids[static_cast<std::size_t>(i)] = juce::Identifier{ "property-" + juce::String{ i } };
+    }
+
+    void prepareIteration(jive::Interpreter&) final
+    {
+        for (auto& property : properties)
+            property.reset();
+
+        tree = juce::ValueTree{ "Component" };
+    }
+
+    void doIteration(jive::Interpreter&) final
+    {
+        for (std::size_t i = 0; i < properties.size(); i++)
+            properties[i].emplace(tree, ids[i]);
+    }
+
+    void tearDown() final
+    {
+        for (auto& property : properties)
+            property.reset();
+
+        tree = juce::ValueTree{};
+    }
+
+    void appendMetrics(Result& result) const final
+    {
+        result.metrics.push_back({
+            "bytes-per-property",
+            static_cast<double>(sizeof(jive::Property<int>)),
+            false,
+        });
+
+        std::vector<Metric> perProperty;
+
+        for (const auto& metric : result.metrics)
+        {
+            if (metric.name == "allocations" || metric.name == "allocated-bytes")
+                perProperty.push_back({ metric.name + "-per-property", metric.valuePerIteration / numProperties, false });
+        }
+
+        for (auto& metric : perProperty)
+            result.metrics.push_back(std::move(metric));
+    }
+
+private:
+    // Roughly as many as a flex item's decorators bind to its tree.
+    static constexpr auto numProperties = 32;
+
+    std::array<juce::Identifier, numProperties> ids;
+    std::array<std::optional<jive::Property<int>>, numProperties> properties;
+    juce::ValueTree tree;
+};
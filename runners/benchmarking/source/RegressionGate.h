@@ -0,0 +1,167 @@
+#pragma once
+
+#include "Benchmark.h"
+
+/** Compares benchmark results against a baseline previously written with
+    --json, flagging any metric that's worse than its baseline by more than
+    the given tolerance.
+
+    Every metric a benchmark reports is compared, other than timings, which
+    are only comparable on the machine the baseline was measured on. Those
+    (the median, p95 and p99 times, and any per-phase times or throughputs)
+    are only compared when timings are gated too. Metrics measured per second
+    are expected to be higher than their baseline, all others lower.
+*/
+class RegressionGate
+{
+public:
+    struct Regression
+    {
+        juce::String benchmark;
+        juce::String metric;
+        double baseline;
+        double current;
+    };
+
+    RegressionGate(const juce::var& baselineDocument, double tolerancePercent, bool shouldGateTimings)
+        : baseline{ flatten(baselineDocument) }
+        , tolerance{ tolerancePercent / 100.0 }
+        , gateTimings{ shouldGateTimings }
+    {
+    }
+
+    [[nodiscard]] static std::optional<RegressionGate> fromFile(const juce::File& file,
+                                                                double tolerancePercent,
+                                                                bool shouldGateTimings)
+    {
+        if (!file.existsAsFile())
+            return std::nullopt;
+
+        const auto document = juce::JSON::parse(file);
+
+        if (!document.hasProperty("benchmarks"))
+            return std::nullopt;
+
+        return RegressionGate{ document, tolerancePercent, shouldGateTimings };
+    }
+
+    [[nodiscard]] std::vector<Regression> check(const std::vector<Benchmark::Result>& results) const
+    {
+        std::vector<Regression> regressions;
+
+        for (const auto& result : results)
+        {
+            const auto baselineMetrics = baseline.find(result.name);
+
+            if (baselineMetrics == std::end(baseline))
+            {
+                std::cout << "No baseline for " << result.name << "\n";
+                continue;
+            }
+
+            for (const auto& [metric, current] : flatten(result))
+            {
+                if (isTiming(metric) && !gateTimings)
+                    continue;
+
+                const auto baselineValue = baselineMetrics->second.find(metric);
+
+                if (baselineValue == std::end(baselineMetrics->second))
+                    continue;
+
+                if (isRegression(metric, baselineValue->second, current))
+                    regressions.push_back({ result.name, metric, baselineValue->second, current });
+            }
+        }
+
+        return regressions;
+    }
+
+    static void print(const std::vector<Regression>& regressions)
+    {
+        if (regressions.empty())
+        {
+            std::cout << "No regressions against baseline\n";
+            return;
+        }
+
+        std::cout << regressions.size() << " regression(s) against baseline\n\n";
+
+        for (const auto& regression : regressions)
+        {
+            const auto change = regression.baseline != 0.0
+                                  ? juce::String{ (regression.current / regression.baseline - 1.0) * 100.0, 1 } + "%"
+                                  : juce::String{ "new" };
+
+            std::cout << regression.benchmark << " " << regression.metric << ": "
+                      << regression.baseline << " -> " << regression.current
+                      << " (" << change << ")\n";
+        }
+
+        std::cout << "\n";
+    }
+
+private:
+    using Metrics = std::map<juce::String, double>;
+
+    [[nodiscard]] static bool isTiming(const juce::String& metric)
+    {
+        return metric.startsWith("milliseconds.")
+            || metric.endsWith(".milliseconds")
+            || metric.endsWith("per-second");
+    }
+
+    [[nodiscard]] bool isRegression(const juce::String& metric, double baselineValue, double current) const
+    {
+        if (metric.endsWith("per-second"))
+            return current < baselineValue * (1.0 - tolerance);
+
+        return current > baselineValue * (1.0 + tolerance);
+    }
+
+    [[nodiscard]] static Metrics flatten(const Benchmark::Result& result)
+    {
+        Metrics metrics{
+            { "milliseconds.median", result.milliseconds.median },
+            { "milliseconds.p95", result.milliseconds.p95 },
+            { "milliseconds.p99", result.milliseconds.p99 },
+        };
+
+        for (const auto& metric : result.metrics)
+            metrics[metric.name] = metric.valuePerIteration;
+
+        return metrics;
+    }
+
+    [[nodiscard]] static std::map<juce::String, Metrics> flatten(const juce::var& document)
+    {
+        std::map<juce::String, Metrics> benchmarks;
+
+        if (const auto* array = document["benchmarks"].getArray())
+        {
+            for (const auto& benchmark : *array)
+            {
+                auto& metrics = benchmarks[benchmark["name"].toString()];
+                const auto& milliseconds = benchmark["milliseconds"];
+
+                for (const auto* statistic : { "median", "p95", "p99" })
+                {
+                    if (milliseconds.hasProperty(statistic))
+                        metrics["milliseconds." + juce::String{ statistic }] = milliseconds[statistic];
+                }
+
+                if (const auto* object = benchmark["metrics"].getDynamicObject())
+                {
+                    for (const auto& metric : object->getProperties())
+                        metrics[metric.name.toString()] = metric.value;
+                }
+            }
+        }
+
+        return benchmarks;
+    }
+
+    const std::map<juce::String, Metrics> baseline;
+    const double tolerance;
+    const bool gateTimings;
+};
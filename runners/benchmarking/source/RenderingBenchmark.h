@@ -0,0 +1,241 @@
+#pragma once
+
+#include "Benchmark.h"
+
+/** Renders an interpreted view into an offscreen image with the software
+    renderer, one frame per iteration.
+
+    Backgrounds, borders and gradients are only painted when style sheets are
+    enabled, so those scenarios should be run with the production-profile
+    benchmarking target.
+*/
+class RenderingBenchmark : public Benchmark
+{
+public:
+    enum class Scenario
+    {
+        solid,
+        borderRadii,
+        gradients,
+        lightText,
+        heavyText,
+        bufferedToImage,
+    };
+
+    explicit RenderingBenchmark(Scenario scenarioToRender)
+        : Benchmark{
+            "Rendering/" + getName(scenarioToRender),
+            "Offscreen Rendering of " + getDescription(scenarioToRender),
+            juce::RelativeTime::seconds(5.0),
+        }
+        , scenario{ scenarioToRender }
+    {
+    }
+
+    [[nodiscard]] static std::vector<std::unique_ptr<Benchmark>> createSuite()
+    {
+        std::vector<std::unique_ptr<Benchmark>> suite;
+
+        for (const auto scenario : {
+                 Scenario::solid,
+                 Scenario::borderRadii,
+                 Scenario::gradients,
+                 Scenario::lightText,
+                 Scenario::heavyText,
+                 Scenario::bufferedToImage,
+             })
+        {
+            suite.push_back(std::make_unique<RenderingBenchmark>(scenario));
+        }
+
+        return suite;
+    }
+
+protected:
+    void setUp(jive::Interpreter& interpreter) final
+    {
+        view = createView(scenario);
+        item = interpreter.interpret(view);
+        frame = juce::Image{
+            juce::Image::ARGB,
+            frameWidth,
+            frameHeight,
+            true,
+            juce::SoftwareImageType{},
+        };
+    }
+
+    void doIteration(jive::Interpreter&) final
+    {
+        juce::Graphics graphics{ frame };
+        graphics.fillAll(juce::Colours::black);
+        item->getComponent()->paintEntireComponent(graphics, false);
+    }
+
+    void tearDown() final
+    {
+        item = nullptr;
+        view = juce::ValueTree{};
+        frame = juce::Image{};
+    }
+
+    void appendMetrics(Result& result) const final
+    {
+        if (result.milliseconds.median <= 0.0)
+            return;
+
+        result.metrics.push_back({
+            "pixels-per-second",
+            frameWidth * frameHeight / (result.milliseconds.median / 1000.0),
+            false,
+        });
+    }
+
+private:
+    [[nodiscard]] static juce::String getName(Scenario scenario)
+    {
+        switch (scenario)
+        {
+        case Scenario::solid:
+            return "solid";
+        case Scenario::borderRadii:
+            return "border-radius";
+        case Scenario::gradients:
+            return "gradient";
+        case Scenario::lightText:
+            return "light-text";
+        case Scenario::heavyText:
+            return "heavy-text";
+        case Scenario::bufferedToImage:
+            return "buffered-to-image";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    [[nodiscard]] static juce::String getDescription(Scenario scenario)
+    {
+        switch (scenario)
+        {
+        case Scenario::solid:
+            return "Solid Backgrounds";
+        case Scenario::borderRadii:
+            return "Rounded Borders";
+        case Scenario::gradients:
+            return "Gradient Backgrounds";
+        case Scenario::lightText:
+            return "a Little Text";
+        case Scenario::heavyText:
+            return "a Lot of Text";
+        case Scenario::bufferedToImage:
+            return "Views Buffered to Images";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    [[nodiscard]] static juce::var createStyle(Scenario scenario)
+    {
+        auto* style = new jive::Object{
+            { "background", "#203040" },
+            { "foreground", "#FAFAFA" },
+        };
+
+        if (scenario == Scenario::borderRadii || scenario == Scenario::bufferedToImage)
+        {
+            style->setProperty("border", "#FFFFFF");
+            style->setProperty("border-radius", "4, 8, 12, 16");
+        }
+
+        if (scenario == Scenario::gradients || scenario == Scenario::bufferedToImage)
+        {
+            style->setProperty("background",
+                               new jive::Object{
+                                   { "gradient", "linear" },
+                                   {
+                                       "stops",
+                                       new jive::Object{
+                                           { "0.0", "#FF00FF" },
+                                           { "0.5", "#203040" },
+                                           { "1.0", "#00FFFF" },
+                                       },
+                                   },
+                               });
+        }
+
+        return style;
+    }
+
+    [[nodiscard]] static juce::ValueTree createView(Scenario scenario)
+    {
+        static constexpr auto numColumns = 8;
+        static constexpr auto numRows = 6;
+
+        const auto text = [scenario]() -> juce::String {
+            switch (scenario)
+            {
+            case Scenario::lightText:
+                return "Lorem ipsum";
+            case Scenario::heavyText:
+            case Scenario::bufferedToImage:
+                return "Quisque hendrerit pharetra libero, nec eleifend felis blandit sed. Etiam in ligula efficitur, volutpat turpis luctus, dictum mauris. Proin ipsum nunc, lobortis in suscipit et, elementum eget felis.";
+            case Scenario::solid:
+            case Scenario::borderRadii:
+            case Scenario::gradients:
+                break;
+            }
+
+            return {};
+        }();
+
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", frameWidth },
+                { "height", frameHeight },
+                { "flex-wrap", "wrap" },
+                { "buffered-to-image", scenario == Scenario::bufferedToImage },
+            },
+        };
+
+        for (auto i = 0; i < numColumns * numRows; i++)
+        {
+            juce::ValueTree tile{
+                "Component",
+                {
+                    { "width", frameWidth / numColumns },
+                    { "height", frameHeight / numRows },
+                    { "border-width", 2 },
+                    { "style", createStyle(scenario) },
+                },
+            };
+
+            if (text.isNotEmpty())
+            {
+                tile.appendChild(juce::ValueTree{
+                                     "Text",
+                                     {
+                                         { "text", text },
+                                         { "width", "100%" },
+                                     },
+                                 },
+                                 nullptr);
+            }
+
+            view.appendChild(tile, nullptr);
+        }
+
+        return view;
+    }
+
+    static constexpr auto frameWidth = 800;
+    static constexpr auto frameHeight = 600;
+
+    const Scenario scenario;
+
+    juce::ValueTree view;
+    std::unique_ptr<jive::GuiItem> item;
+    juce::Image frame;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Benchmark.h"
+
+/** Replays a recording made with jive::MutationRecorder against a freshly
+    interpreted view on each iteration, as fast as possible.
+
+    Only the replay is timed - interpreting the view to replay into is not.
+*/
+class ReplayBenchmark : public Benchmark
+{
+public:
+    ReplayBenchmark(const juce::File& file, jive::MutationRecording mutationRecording)
+        : Benchmark{
+            "Replay/" + file.getFileName(),
+            "Replay of " + juce::String{ static_cast<int>(mutationRecording.getEvents().size()) } + " Recorded Mutations",
+            juce::RelativeTime::seconds(10.0),
+        }
+        , recording{ std::move(mutationRecording) }
+    {
+    }
+
+    [[nodiscard]] static std::vector<std::unique_ptr<Benchmark>> createFromFiles(const juce::StringArray& paths)
+    {
+        std::vector<std::unique_ptr<Benchmark>> benchmarks;
+
+        for (const auto& path : paths)
+        {
+            const auto file = juce::File::getCurrentWorkingDirectory().getChildFile(path.trim());
+
+            if (auto recording = jive::MutationRecording::readFromFile(file))
+                benchmarks.push_back(std::make_unique<ReplayBenchmark>(file, std::move(*recording)));
+            else
+                std::cerr << "Failed to read recording from " << file.getFullPathName() << "\n";
+        }
+
+        return benchmarks;
+    }
+
+protected:
+    void prepareIteration(jive::Interpreter& interpreter) final
+    {
+        item = nullptr;
+        view = recording.getInitialState().createCopy();
+        item = interpreter.interpret(view);
+    }
+
+    void doIteration(jive::Interpreter&) final
+    {
+        for (const auto& event : recording.getEvents())
+            jive::MutationRecording::apply(event, view);
+    }
+
+    void tearDown() final
+    {
+        item = nullptr;
+        view = juce::ValueTree{};
+    }
+
+private:
+    const jive::MutationRecording recording;
+
+    juce::ValueTree view;
+    std::unique_ptr<jive::GuiItem> item;
+};
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Benchmark.h"
+
+class ResultsWriter
+{
+public:
+    explicit ResultsWriter(const std::vector<Benchmark::Result>& benchmarkResults)
+        : results{ benchmarkResults }
+    {
+    }
+
+    [[nodiscard]] juce::String toJSON() const
+    {
+        juce::Array<juce::var> benchmarks;
+
+        for (const auto& result : results)
+        {
+            auto* benchmark = new juce::DynamicObject;
+            benchmark->setProperty("name", result.name);
+            benchmark->setProperty("description", result.description);
+            benchmark->setProperty("milliseconds", toVar(result.milliseconds));
+
+            if (result.family.isNotEmpty())
+            {
+                benchmark->setProperty("family", result.family);
+                benchmark->setProperty("problem-size", result.problemSize);
+            }
+
+            auto* metrics = new juce::DynamicObject;
+
+            for (const auto& metric : result.metrics)
+                metrics->setProperty(metric.name, metric.valuePerIteration);
+
+            benchmark->setProperty("metrics", juce::var{ metrics });
+
+            benchmarks.add(juce::var{ benchmark });
+        }
+
+        auto* document = new juce::DynamicObject;
+        document->setProperty("benchmarks", benchmarks);
+
+        return juce::JSON::toString(juce::var{ document });
+    }
+
+    [[nodiscard]] juce::String toCSV() const
+    {
+        juce::StringArray lines;
+        lines.add("name,metric,samples,outliers,mean,stddev,min,median,p95,p99,max");
+
+        for (const auto& result : results)
+        {
+            lines.add(toCSVLine(result.name, "milliseconds", result.milliseconds));
+
+            for (const auto& metric : result.metrics)
+            {
+                lines.add(result.name.quoted()
+                          + "," + metric.name
+                          + "," + juce::String{ result.milliseconds.numSamples }
+                          + ",," + juce::String{ metric.valuePerIteration }
+                          + ",,,,,,");
+            }
+        }
+
+        return lines.joinIntoString("\n") + "\n";
+    }
+
+    void writeJSON(const juce::File& file) const
+    {
+        write(toJSON(), file);
+    }
+
+    void writeCSV(const juce::File& file) const
+    {
+        write(toCSV(), file);
+    }
+
+private:
+    static void write(const juce::String& content, const juce::File& file)
+    {
+        if (file == juce::File{})
+            return;
+
+        if (!file.replaceWithText(content))
+            std::cerr << "Failed to write results to " << file.getFullPathName() << "\n";
+    }
+
+    [[nodiscard]] static juce::var toVar(const Statistics& statistics)
+    {
+        auto* object = new juce::DynamicObject;
+        object->setProperty("samples", statistics.numSamples);
+        object->setProperty("outliers", statistics.numOutliers);
+        object->setProperty("mean", statistics.mean);
+        object->setProperty("stddev", statistics.standardDeviation);
+        object->setProperty("min", statistics.min);
+        object->setProperty("median", statistics.median);
+        object->setProperty("p95", statistics.p95);
+        object->setProperty("p99", statistics.p99);
+        object->setProperty("max", statistics.max);
+
+        return juce::var{ object };
+    }
+
+    [[nodiscard]] static juce::String toCSVLine(const juce::String& name,
+                                                const juce::String& metric,
+                                                const Statistics& statistics)
+    {
+        juce::StringArray fields;
+        fields.add(name.quoted());
+        fields.add(metric);
+        fields.add(juce::String{ statistics.numSamples });
+        fields.add(juce::String{ statistics.numOutliers });
+
+        for (const auto value : {
+                 statistics.mean,
+                 statistics.standardDeviation,
+                 statistics.min,
+                 statistics.median,
+                 statistics.p95,
+                 statistics.p99,
+                 statistics.max,
+             })
+        {
+            fields.add(juce::String{ value });
+        }
+
+        return fields.joinIntoString(",");
+    }
+
+    const std::vector<Benchmark::Result>& results;
+};
@@ -0,0 +1,225 @@
+#pragma once
+
+#include "Benchmark.h"
+
+class ScalabilityBenchmark : public Benchmark
+{
+public:
+    enum class Operation
+    {
+        interpret,
+        mutateLeaf,
+        resizeRoot,
+    };
+
+    struct Shape
+    {
+        juce::String name;
+        int fanOut;
+        int maxNumNodes;
+    };
+
+    ScalabilityBenchmark(jive::Display containerDisplay,
+                         const Shape& treeShape,
+                         Operation operationToMeasure,
+                         int numberOfNodes)
+        : Benchmark{
+            getFamilyName(containerDisplay, treeShape, operationToMeasure) + "/" + juce::String{ numberOfNodes },
+            "Scalability of " + getDescription(operationToMeasure) + " over " + juce::String{ numberOfNodes } + " nodes",
+            juce::jlimit(3, 100, 100000 / numberOfNodes),
+        }
+        , display{ containerDisplay }
+        , shape{ treeShape }
+        , operation{ operationToMeasure }
+        , numNodes{ numberOfNodes }
+    {
+        setNumWarmUpIterations(numNodes >= 10000 ? 1 : 3);
+        setProblemSize(getFamilyName(display, shape, operation), numNodes);
+    }
+
+    bool isRunByDefault() const final
+    {
+        return false;
+    }
+
+    [[nodiscard]] static std::vector<std::unique_ptr<Benchmark>> createSuite(int maxNumNodes)
+    {
+        // Very deep trees are limited in size as the interpreter recurses once
+        // per level of the tree.
+        static const std::vector<Shape> shapes{
+            Shape{ "flat", std::numeric_limits<int>::max(), std::numeric_limits<int>::max() },
+            Shape{ "fan-out-8", 8, std::numeric_limits<int>::max() },
+            Shape{ "binary", 2, std::numeric_limits<int>::max() },
+            Shape{ "chain", 1, 1000 },
+        };
+
+        std::vector<std::unique_ptr<Benchmark>> suite;
+
+        for (const auto display : { jive::Display::flex, jive::Display::grid, jive::Display::block })
+        {
+            for (const auto& shape : shapes)
+            {
+                for (const auto operation : { Operation::interpret, Operation::mutateLeaf, Operation::resizeRoot })
+                {
+                    for (auto numNodes = 10;
+                         numNodes <= juce::jmin(maxNumNodes, shape.maxNumNodes);
+                         numNodes *= 10)
+                    {
+                        suite.push_back(std::make_unique<ScalabilityBenchmark>(display,
+                                                                               shape,
+                                                                               operation,
+                                                                               numNodes));
+                    }
+                }
+            }
+        }
+
+        return suite;
+    }
+
+    /** Builds a tree of the given number of nodes where each node has, at
+        most, the given number of children. Nodes are added breadth-first so
+        the last node in the tree is always one of the deepest leaves.
+    */
+    [[nodiscard]] static juce::ValueTree createView(jive::Display display, int numNodes, int fanOut)
+    {
+        const auto displayValue = juce::VariantConverter<jive::Display>::toVar(display);
+        juce::ValueTree root{
+            "Component",
+            {
+                { "width", 1000 },
+                { "height", 1000 },
+                { "display", displayValue },
+            },
+        };
+        std::vector<juce::ValueTree> nodes{ root };
+
+        for (std::size_t parentIndex = 0; static_cast<int>(nodes.size()) < numNodes; parentIndex++)
+        {
+            auto parent = nodes[parentIndex];
+
+            for (auto i = 0; i < fanOut && static_cast<int>(nodes.size()) < numNodes; i++)
+            {
+                juce::ValueTree child{
+                    "Component",
+                    {
+                        { "display", displayValue },
+                    },
+                };
+                parent.appendChild(child, nullptr);
+                nodes.push_back(child);
+            }
+        }
+
+        for (auto& node : nodes)
+        {
+            if (node != root && node.getNumChildren() == 0)
+            {
+                node.setProperty("width", 10, nullptr);
+                node.setProperty("height", 10, nullptr);
+            }
+        }
+
+        return root;
+    }
+
+protected:
+    void setUp(jive::Interpreter& interpreter) final
+    {
+        view = createView(display, numNodes, shape.fanOut);
+
+        if (operation != Operation::interpret)
+        {
+            item = interpreter.interpret(view);
+            leaf = findLastLeaf(view);
+        }
+    }
+
+    void doIteration(jive::Interpreter& interpreter) final
+    {
+        toggle = !toggle;
+
+        switch (operation)
+        {
+        case Operation::interpret:
+        {
+            const auto interpretedItem = interpreter.interpret(view.createCopy());
+            break;
+        }
+        case Operation::mutateLeaf:
+            leaf.setProperty("width", toggle ? 11 : 10, nullptr);
+            break;
+        case Operation::resizeRoot:
+            item->getComponent()->setSize(toggle ? 1001 : 1000, 1000);
+            break;
+        }
+    }
+
+    void tearDown() final
+    {
+        item = nullptr;
+        leaf = juce::ValueTree{};
+        view = juce::ValueTree{};
+    }
+
+private:
+    [[nodiscard]] static juce::String getFamilyName(jive::Display display,
+                                                    const Shape& shape,
+                                                    Operation operation)
+    {
+        return "Scalability/"
+             + juce::VariantConverter<jive::Display>::toVar(display).toString()
+             + "/" + shape.name
+             + "/" + getName(operation);
+    }
+
+    [[nodiscard]] static juce::String getName(Operation operation)
+    {
+        switch (operation)
+        {
+        case Operation::interpret:
+            return "interpret";
+        case Operation::mutateLeaf:
+            return "mutate-leaf";
+        case Operation::resizeRoot:
+            return "resize-root";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    [[nodiscard]] static juce::String getDescription(Operation operation)
+    {
+        switch (operation)
+        {
+        case Operation::interpret:
+            return "interpreting";
+        case Operation::mutateLeaf:
+            return "mutating a leaf";
+        case Operation::resizeRoot:
+            return "resizing the root";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    [[nodiscard]] static juce::ValueTree findLastLeaf(juce::ValueTree tree)
+    {
+        while (tree.getNumChildren() > 0)
+            tree = tree.getChild(tree.getNumChildren() - 1);
+
+        return tree;
+    }
+
+    const jive::Display display;
+    const Shape shape;
+    const Operation operation;
+    const int numNodes;
+
+    juce::ValueTree view;
+    std::unique_ptr<jive::GuiItem> item;
+    juce::ValueTree leaf;
+    bool toggle = false;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+struct Statistics
+{
+    int numSamples = 0;
+    int numOutliers = 0;
+    double mean = 0.0;
+    double standardDeviation = 0.0;
+    double min = 0.0;
+    double median = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double max = 0.0;
+
+    /** Calculates the statistics of the given samples.
+
+        The minimum, percentiles and maximum are taken from every sample, as
+        the tail they describe is exactly what rejecting outliers would hide.
+        The mean and standard deviation are calculated after rejecting any
+        outliers that lie outside of Tukey's fences, i.e. more than 1.5 times
+        the inter-quartile range below the first or above the third quartile.
+    */
+    [[nodiscard]] static Statistics fromSamples(std::vector<double> samples)
+    {
+        Statistics statistics;
+
+        if (samples.empty())
+            return statistics;
+
+        std::sort(std::begin(samples), std::end(samples));
+
+        statistics.numSamples = static_cast<int>(samples.size());
+        statistics.min = samples.front();
+        statistics.median = percentile(samples, 50.0);
+        statistics.p95 = percentile(samples, 95.0);
+        statistics.p99 = percentile(samples, 99.0);
+        statistics.max = samples.back();
+
+        const auto lowerQuartile = percentile(samples, 25.0);
+        const auto upperQuartile = percentile(samples, 75.0);
+        const auto interQuartileRange = upperQuartile - lowerQuartile;
+        const auto lowerFence = lowerQuartile - 1.5 * interQuartileRange;
+        const auto upperFence = upperQuartile + 1.5 * interQuartileRange;
+
+        // The samples are sorted, so those within the fences are contiguous.
+        const auto first = std::lower_bound(std::begin(samples), std::end(samples), lowerFence);
+        const auto last = std::upper_bound(first, std::end(samples), upperFence);
+        const auto numInliers = static_cast<double>(std::distance(first, last));
+
+        statistics.numOutliers = statistics.numSamples - static_cast<int>(std::distance(first, last));
+        statistics.mean = std::accumulate(first, last, 0.0) / numInliers;
+
+        auto sumOfSquaredDifferences = 0.0;
+
+        for (auto sample = first; sample != last; sample++)
+            sumOfSquaredDifferences += (*sample - statistics.mean) * (*sample - statistics.mean);
+
+        statistics.standardDeviation = std::sqrt(sumOfSquaredDifferences / numInliers);
+
+        return statistics;
+    }
+
+private:
+    [[nodiscard]] static double percentile(const std::vector<double>& sortedSamples, double percent)
+    {
+        jassert(!sortedSamples.empty());
+
+        const auto position = percent / 100.0 * static_cast<double>(sortedSamples.size() - 1);
+        const auto lowerIndex = static_cast<std::size_t>(std::floor(position));
+        const auto upperIndex = juce::jmin(lowerIndex + 1, sortedSamples.size() - 1);
+        const auto fraction = position - static_cast<double>(lowerIndex);
+
+        return sortedSamples[lowerIndex]
+             + fraction * (sortedSamples[upperIndex] - sortedSamples[lowerIndex]);
+    }
+};
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "Benchmark.h"
+
+#if JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
+class StyleSheetBenchmark : public Benchmark
+{
+public:
+    enum class Scenario
+    {
+        applyStyles,
+        interactionState,
+        fontInheritance,
+        rootStyleChange,
+    };
+
+    explicit StyleSheetBenchmark(Scenario scenarioToMeasure)
+        : Benchmark{
+            "StyleSheet/" + getName(scenarioToMeasure),
+            "jive::StyleSheet " + getDescription(scenarioToMeasure),
+            juce::RelativeTime::seconds(5.0),
+        }
+        , scenario{ scenarioToMeasure }
+    {
+    }
+
+    [[nodiscard]] static std::vector<std::unique_ptr<Benchmark>> createSuite()
+    {
+        std::vector<std::unique_ptr<Benchmark>> suite;
+
+        for (const auto scenario : {
+                 Scenario::applyStyles,
+                 Scenario::interactionState,
+                 Scenario::fontInheritance,
+                 Scenario::rootStyleChange,
+             })
+        {
+            suite.push_back(std::make_unique<StyleSheetBenchmark>(scenario));
+        }
+
+        return suite;
+    }
+
+protected:
+    void setUp(jive::Interpreter& interpreter) final
+    {
+        view = createView();
+        item = interpreter.interpret(view);
+        group = view.getChild(view.getNumChildren() / 2);
+    }
+
+    void doIteration(jive::Interpreter&) final
+    {
+        toggle = !toggle;
+
+        switch (scenario)
+        {
+        case Scenario::applyStyles:
+            // Changing a selector re-applies the styles of the item and all
+            // of its descendants.
+            view.setProperty("class", toggle ? "highlighted" : "", nullptr);
+            break;
+        case Scenario::interactionState:
+            group.setProperty("mouse", toggle ? "hover" : "dissociate", nullptr);
+            group.setProperty("keyboard", toggle ? "focus" : "dissociate", nullptr);
+            break;
+        case Scenario::fontInheritance:
+            if (auto* style = dynamic_cast<jive::Object*>(view["style"].getObject()))
+                style->setProperty("font-size", toggle ? 15 : 14);
+            break;
+        case Scenario::rootStyleChange:
+            view.setProperty("style", createRootStyle(toggle ? "#202020" : "#101010"), nullptr);
+            break;
+        }
+    }
+
+    void tearDown() final
+    {
+        item = nullptr;
+        group = juce::ValueTree{};
+        view = juce::ValueTree{};
+    }
+
+private:
+    [[nodiscard]] static juce::String getName(Scenario scenario)
+    {
+        switch (scenario)
+        {
+        case Scenario::applyStyles:
+            return "apply-styles";
+        case Scenario::interactionState:
+            return "hover-focus";
+        case Scenario::fontInheritance:
+            return "font-inheritance";
+        case Scenario::rootStyleChange:
+            return "root-style-change";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    [[nodiscard]] static juce::String getDescription(Scenario scenario)
+    {
+        switch (scenario)
+        {
+        case Scenario::applyStyles:
+            return "Re-Applying Styles to a Tree";
+        case Scenario::interactionState:
+            return "Hover and Focus Selector Changes";
+        case Scenario::fontInheritance:
+            return "Inherited Font Changes";
+        case Scenario::rootStyleChange:
+            return "Restyling a Tree From its Root";
+        }
+
+        jassertfalse;
+        return {};
+    }
+
+    [[nodiscard]] static juce::var createRootStyle(const juce::String& background)
+    {
+        return new jive::Object{
+            { "background", background },
+            { "foreground", "#FAFAFA" },
+            { "font-family", "Helvetica" },
+            { "font-size", 14 },
+            { "border-radius", 4 },
+            {
+                ".highlighted",
+                new jive::Object{
+                    { "background", "#303030" },
+                },
+            },
+            {
+                "Button",
+                new jive::Object{
+                    { "background", "#2060A0" },
+                    { "font-weight", "bold" },
+                },
+            },
+            {
+                "hover",
+                new jive::Object{
+                    { "background", "#404040" },
+                    { "border", "#FFFFFF" },
+                },
+            },
+            {
+                "focus",
+                new jive::Object{
+                    { "border", "#20A0FF" },
+                },
+            },
+        };
+    }
+
+    [[nodiscard]] static juce::ValueTree createView()
+    {
+        static constexpr auto text = [] {
+            return juce::ValueTree{
+                "Text",
+                {
+                    { "text", "Quisque hendrerit pharetra libero, nec eleifend felis blandit sed." },
+                },
+            };
+        };
+        static constexpr auto group = [] {
+            return juce::ValueTree{
+                "Component",
+                {
+                    { "style", new jive::Object{ { "font-style", "italic" } } },
+                },
+                {
+                    juce::ValueTree{
+                        "Button",
+                        {},
+                        {
+                            text(),
+                        },
+                    },
+                    text(),
+                    text(),
+                    text(),
+                    text(),
+                    text(),
+                },
+            };
+        };
+
+        juce::ValueTree view{
+            "Component",
+            {
+                { "width", 540 },
+                { "height", 360 },
+                { "flex-wrap", "wrap" },
+                { "style", createRootStyle("#101010") },
+            },
+        };
+
+        for (auto i = 0; i < 16; i++)
+            view.appendChild(group(), nullptr);
+
+        return view;
+    }
+
+    const Scenario scenario;
+
+    juce::ValueTree view;
+    std::unique_ptr<jive::GuiItem> item;
+    juce::ValueTree group;
+    bool toggle = false;
+};
+#endif
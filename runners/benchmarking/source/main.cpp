@@ -1,5 +1,16 @@
+#include "BlockStressTest.h"
+#include "ComplexityAnalysis.h"
 #include "FlexStressTest.h"
+#include "GridStressTest.h"
 #include "MinimumViewBenchmark.h"
+#include "MutationLatencyBenchmark.h"
+#include "PropertyFootprintBenchmark.h"
+#include "RegressionGate.h"
+#include "RenderingBenchmark.h"
+#include "ReplayBenchmark.h"
+#include "ResultsWriter.h"
+#include "ScalabilityBenchmark.h"
+#include "StyleSheetBenchmark.h"
 
 #include <jive_core/jive_core.h>
 
@@ -18,10 +29,94 @@ public:
         return "1.0.0";
     }
 
-    void initialise(const juce::String&) final
+    void initialise(const juce::String& commandLine) final
     {
-        MinimumViewBenchmark{}.run();
-        FlexStressTest{}.run();
+        const juce::ArgumentList arguments{ getApplicationName(), commandLine };
+
+        if (arguments.containsOption("--help"))
+        {
+            printUsage();
+            quit();
+            return;
+        }
+
+        const auto maxNumNodes = arguments.containsOption("--max-nodes")
+                                   ? arguments.getValueForOption("--max-nodes").getIntValue()
+                                   : 10000;
+        auto benchmarks = createBenchmarks(arguments.getValueForOption("--filter"), maxNumNodes);
+
+        // Recordings given explicitly are always run, regardless of the filter.
+        const auto recordings = juce::StringArray::fromTokens(arguments.getValueForOption("--replay"), ",", "");
+
+        for (auto& benchmark : ReplayBenchmark::createFromFiles(recordings))
+            benchmarks.push_back(std::move(benchmark));
+
+        if (arguments.containsOption("--list"))
+        {
+            for (const auto& benchmark : benchmarks)
+                std::cout << benchmark->getName() << "\n";
+
+            quit();
+            return;
+        }
+
+        AllocationCounter::setEnabled(arguments.containsOption("--allocations"));
+        std::vector<Benchmark::Result> results;
+
+        for (const auto& benchmark : benchmarks)
+        {
+            if (arguments.containsOption("--warmup"))
+                benchmark->setNumWarmUpIterations(arguments.getValueForOption("--warmup").getIntValue());
+
+            results.push_back(benchmark->run());
+        }
+
+        const ResultsWriter writer{ results };
+
+        writer.writeJSON(getFileForOption(arguments, "--json"));
+        writer.writeCSV(getFileForOption(arguments, "--csv"));
+
+        const ComplexityAnalysis complexity{ results };
+        const auto maxExponent = arguments.containsOption("--max-exponent")
+                                   ? arguments.getValueForOption("--max-exponent").getDoubleValue()
+                                   : 1.5;
+        complexity.print(maxExponent);
+        complexity.writeCSV(getFileForOption(arguments, "--complexity"));
+
+        if (arguments.containsOption("--max-exponent"))
+        {
+            if (const auto superLinear = complexity.getFamiliesExceeding(maxExponent);
+                !superLinear.isEmpty())
+            {
+                std::cerr << "Super-linear scaling detected in: " << superLinear.joinIntoString(", ") << "\n";
+                setApplicationReturnValue(1);
+            }
+        }
+
+        if (const auto baselineFile = getFileForOption(arguments, "--baseline");
+            baselineFile != juce::File{})
+        {
+            const auto tolerance = arguments.containsOption("--tolerance")
+                                     ? arguments.getValueForOption("--tolerance").getDoubleValue()
+                                     : 10.0;
+
+            if (const auto gate = RegressionGate::fromFile(baselineFile,
+                                                           tolerance,
+                                                           arguments.containsOption("--gate-timings")))
+            {
+                const auto regressions = gate->check(results);
+                RegressionGate::print(regressions);
+
+                if (!regressions.empty())
+                    setApplicationReturnValue(1);
+            }
+            else
+            {
+                std::cerr << "Failed to read baseline from " << baselineFile.getFullPathName() << "\n";
+                setApplicationReturnValue(1);
+            }
+        }
+
         quit();
     }
 
@@ -30,6 +125,89 @@ public:
     }
 
 private:
+    [[nodiscard]] static juce::File getFileForOption(const juce::ArgumentList& arguments, juce::StringRef option)
+    {
+        if (const auto path = arguments.getValueForOption(option);
+            path.isNotEmpty())
+        {
+            return juce::File::getCurrentWorkingDirectory().getChildFile(path);
+        }
+
+        return juce::File{};
+    }
+
+    [[nodiscard]] static auto matchesFilter(const Benchmark& benchmark, const juce::String& filter)
+    {
+        if (filter.isEmpty())
+            return benchmark.isRunByDefault();
+
+        const auto& name = benchmark.getName();
+
+        for (const auto& pattern : juce::StringArray::fromTokens(filter, ",", ""))
+        {
+            if (name.matchesWildcard(pattern.trim(), true) || name.containsIgnoreCase(pattern.trim()))
+                return true;
+        }
+
+        return false;
+    }
+
+    [[nodiscard]] static std::vector<std::unique_ptr<Benchmark>> createBenchmarks(const juce::String& filter, int maxNumNodes)
+    {
+        std::vector<std::unique_ptr<Benchmark>> benchmarks;
+        benchmarks.push_back(std::make_unique<MinimumViewBenchmark>());
+        benchmarks.push_back(std::make_unique<FlexStressTest>());
+        benchmarks.push_back(std::make_unique<GridStressTest>());
+        benchmarks.push_back(std::make_unique<BlockStressTest>());
+        benchmarks.push_back(std::make_unique<PropertyFootprintBenchmark>());
+
+        for (auto& benchmark : MutationLatencyBenchmark::createSuite())
+            benchmarks.push_back(std::move(benchmark));
+
+        for (auto& benchmark : RenderingBenchmark::createSuite())
+            benchmarks.push_back(std::move(benchmark));
+
+        for (auto& benchmark : ScalabilityBenchmark::createSuite(maxNumNodes))
+            benchmarks.push_back(std::move(benchmark));
+
+#if JIVE_GUI_ITEMS_HAVE_STYLE_SHEETS
+        for (auto& benchmark : StyleSheetBenchmark::createSuite())
+            benchmarks.push_back(std::move(benchmark));
+#endif
+
+        benchmarks.erase(std::remove_if(std::begin(benchmarks),
+                                        std::end(benchmarks),
+                                        [&filter](const auto& benchmark) {
+                                            return !matchesFilter(*benchmark, filter);
+                                        }),
+                         std::end(benchmarks));
+
+        return benchmarks;
+    }
+
+    static void printUsage()
+    {
+        std::cout << "Usage: jive-benchmarking [options]\n\n"
+                  << "  --filter=<names>      Comma-separated names or wildcards of the benchmarks to run.\n"
+                  << "                        Benchmarks that aren't run by default, such as the\n"
+                  << "                        Scalability suite, only run when matched by a filter\n"
+                  << "  --list                List the benchmarks that would run, without running them\n"
+                  << "  --warmup=<n>          Number of untimed iterations to run before measuring\n"
+                  << "  --allocations         Count the heap allocations made per iteration, and per item\n"
+                  << "                        created\n"
+                  << "  --replay=<files>      Comma-separated recordings made with jive::MutationRecorder\n"
+                  << "                        to replay against a freshly interpreted view\n"
+                  << "  --max-nodes=<n>       Largest tree, in nodes, of the Scalability suite (default 10000)\n"
+                  << "  --max-exponent=<k>    Fail if any family of benchmarks scales worse than O(n^k)\n"
+                  << "  --baseline=<file>     Fail if any result is worse than the given baseline, written\n"
+                  << "                        previously with --json\n"
+                  << "  --gate-timings        Also fail if any time or throughput is worse than the\n"
+                  << "                        baseline, which should then be from the same machine\n"
+                  << "  --tolerance=<percent> How much worse than its baseline a metric can be (default 10)\n"
+                  << "  --json=<file>         Write the results to the given file as JSON\n"
+                  << "  --csv=<file>          Write the results to the given file as CSV\n"
+                  << "  --complexity=<file>   Write the complexity curves to the given file as CSV\n";
+    }
 };
 
 START_JUCE_APPLICATION(BenchmarkApp)